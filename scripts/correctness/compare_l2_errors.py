@@ -1,8 +1,16 @@
+import argparse
 import numpy as np
 import re
 
 if __name__=='__main__':
-    build_types=['serial','hpx','ompi']
+    parser = argparse.ArgumentParser(description='Compare L2 errors reported by different builds')
+    parser.add_argument('build_types', nargs='*', default=['serial','hpx','ompi'],
+                        help='builds to compare against the first one, reads <build_type>.out')
+    parser.add_argument('--rtol', type=float, default=None,
+                        help='relative tolerance (default: machine precision)')
+    args = parser.parse_args()
+
+    build_types=args.build_types
     error = {}
 
     #floating point regular expression taken from https://stackoverflow.com/a/4703508
@@ -30,10 +38,14 @@ if __name__=='__main__':
 
                 exit(1)
 
-    max_error = max([ error['serial'], error['hpx'], error['ompi'] ])
-    tol = np.finfo(np.float64).eps*max_error*100 #~10^-14
-    if abs( error['serial'] - error['ompi'] ) < tol and abs( error['serial'] - error['hpx' ] ) < tol:
+    max_error = max([ error[bt] for bt in build_types ])
+    if args.rtol is None:
+        tol = np.finfo(np.float64).eps*max_error*100 #~10^-14
+    else:
+        tol = args.rtol*max_error
+
+    if all([ abs( error[build_types[0]] - error[bt] ) < tol for bt in build_types[1:] ]):
        exit(0)
     else:
-        print 'ERROR!!! L2 Errors do not match to machine precision'
+        print 'ERROR!!! L2 Errors do not match to within a tolerance of '+str(tol)
         exit(1)
\ No newline at end of file
@@ -7,6 +7,8 @@
 namespace Basis {
 class Legendre_1D : public Basis<1> {
   public:
+    static constexpr bool is_orthogonal = true;
+
     DynMatrix<double> GetPhi(const uint p, const AlignedVector<Point<1>>& points) override;
     std::array<DynMatrix<double>, 1> GetDPhi(const uint p, const AlignedVector<Point<1>>& points) override;
 
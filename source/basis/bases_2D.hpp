@@ -3,6 +3,7 @@
 
 #include "general_definitions.hpp"
 #include "basis_polynomials.hpp"
+#include "bases_1D.hpp"
 
 namespace Basis {
 /**
@@ -12,6 +13,8 @@ namespace Basis {
  */
 class Dubiner_2D : public Basis<2> {
   public:
+    static constexpr bool is_orthogonal = true;
+
     DynMatrix<double> GetPhi(const uint p, const AlignedVector<Point<2>>& points) override;
     std::array<DynMatrix<double>, 2> GetDPhi(const uint p, const AlignedVector<Point<2>>& points) override;
 
@@ -78,6 +81,39 @@ class Dubiner_2D : public Basis<2> {
      */
     std::array<double, 2> ComputeSingularDPhiDZ2(const uint q);
 };
+
+/**
+ * Legendre tensor product basis class.
+ * This class implements a basis over the reference quadrilateral given via coordinates
+ * (-1,-1), (1,-1), (1,1), and (-1,1). The basis function of dof = i * (p + 1) + j is the
+ * product of the i-th Legendre polynomial in n1 and the j-th Legendre polynomial in n2.
+ */
+class Legendre_2D : public Basis<2> {
+  public:
+    static constexpr bool is_orthogonal = true;
+
+    using Basis1D = Legendre_1D;
+
+    DynMatrix<double> GetPhi(const uint p, const AlignedVector<Point<2>>& points) override;
+    std::array<DynMatrix<double>, 2> GetDPhi(const uint p, const AlignedVector<Point<2>>& points) override;
+
+    DynMatrix<double> GetMinv(const uint p) override;
+
+    DynMatrix<double> GetBasisLinearT(const uint p) override;
+    DynMatrix<double> GetLinearBasisT(const uint p) override;
+
+  private:
+    Legendre_1D basis_1D;
+
+    /**
+     * Get the coordinates of points along one local coordinate direction.
+     *
+     * @param coord local coordinate direction
+     * @param points
+     * @return projection of points onto the direction coord
+     */
+    AlignedVector<Point<1>> GetLineCoordinates(const uint coord, const AlignedVector<Point<2>>& points);
+};
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "../bases_2D.hpp"
+
+namespace Basis {
+DynMatrix<double> Legendre_2D::GetPhi(const uint p, const AlignedVector<Point<2>>& points) {
+    uint ndof_1D = p + 1;
+    uint npt     = points.size();
+
+    DynMatrix<double> phi(ndof_1D * ndof_1D, npt);
+
+    DynMatrix<double> phi_n1 = this->basis_1D.GetPhi(p, this->GetLineCoordinates(LocalCoordQuad::n1, points));
+    DynMatrix<double> phi_n2 = this->basis_1D.GetPhi(p, this->GetLineCoordinates(LocalCoordQuad::n2, points));
+
+    for (uint i = 0; i < ndof_1D; ++i) {
+        for (uint j = 0; j < ndof_1D; ++j) {
+            row(phi, i * ndof_1D + j) = vec_cw_mult(row(phi_n1, i), row(phi_n2, j));
+        }
+    }
+
+    return phi;
+}
+
+std::array<DynMatrix<double>, 2> Legendre_2D::GetDPhi(const uint p, const AlignedVector<Point<2>>& points) {
+    uint ndof_1D = p + 1;
+    uint npt     = points.size();
+
+    std::array<DynMatrix<double>, 2> dphi;
+
+    DynMatrix<double> dphi_dn1(ndof_1D * ndof_1D, npt);
+    DynMatrix<double> dphi_dn2(ndof_1D * ndof_1D, npt);
+
+    AlignedVector<Point<1>> n1 = this->GetLineCoordinates(LocalCoordQuad::n1, points);
+    AlignedVector<Point<1>> n2 = this->GetLineCoordinates(LocalCoordQuad::n2, points);
+
+    DynMatrix<double> phi_n1  = this->basis_1D.GetPhi(p, n1);
+    DynMatrix<double> phi_n2  = this->basis_1D.GetPhi(p, n2);
+    DynMatrix<double> dphi_n1 = this->basis_1D.GetDPhi(p, n1)[LocalCoordLin::l1];
+    DynMatrix<double> dphi_n2 = this->basis_1D.GetDPhi(p, n2)[LocalCoordLin::l1];
+
+    for (uint i = 0; i < ndof_1D; ++i) {
+        for (uint j = 0; j < ndof_1D; ++j) {
+            row(dphi_dn1, i * ndof_1D + j) = vec_cw_mult(row(dphi_n1, i), row(phi_n2, j));
+            row(dphi_dn2, i * ndof_1D + j) = vec_cw_mult(row(phi_n1, i), row(dphi_n2, j));
+        }
+    }
+
+    dphi[LocalCoordQuad::n1] = dphi_dn1;
+    dphi[LocalCoordQuad::n2] = dphi_dn2;
+
+    return dphi;
+}
+
+DynMatrix<double> Legendre_2D::GetMinv(const uint p) {
+    uint ndof_1D = p + 1;
+
+    DynMatrix<double> m_inv(ndof_1D * ndof_1D, ndof_1D * ndof_1D);
+
+    set_constant(m_inv, 0.0);
+
+    for (uint i = 0; i < ndof_1D; ++i) {
+        for (uint j = 0; j < ndof_1D; ++j) {
+            uint dof = i * ndof_1D + j;
+
+            m_inv(dof, dof) = (2 * i + 1) * (2 * j + 1) / 4.0;
+        }
+    }
+
+    return m_inv;
+}
+
+DynMatrix<double> Legendre_2D::GetBasisLinearT(const uint p) {
+    uint ndof_1D  = p + 1;
+    uint ndof_lin = 4;
+
+    DynMatrix<double> T_basis_linear(ndof_1D * ndof_1D, ndof_lin);
+
+    set_constant(T_basis_linear, 0.0);
+
+    // bilinear part of the basis evaluated at the vertices (-1,-1), (1,-1), (1,1), (-1,1)
+    const uint dof_00 = 0;
+    const uint dof_01 = 1;
+    const uint dof_10 = ndof_1D;
+    const uint dof_11 = ndof_1D + 1;
+
+    T_basis_linear(dof_00, 0) = 1.0;
+    T_basis_linear(dof_10, 0) = -1.0;
+    T_basis_linear(dof_01, 0) = -1.0;
+    T_basis_linear(dof_11, 0) = 1.0;
+
+    T_basis_linear(dof_00, 1) = 1.0;
+    T_basis_linear(dof_10, 1) = 1.0;
+    T_basis_linear(dof_01, 1) = -1.0;
+    T_basis_linear(dof_11, 1) = -1.0;
+
+    T_basis_linear(dof_00, 2) = 1.0;
+    T_basis_linear(dof_10, 2) = 1.0;
+    T_basis_linear(dof_01, 2) = 1.0;
+    T_basis_linear(dof_11, 2) = 1.0;
+
+    T_basis_linear(dof_00, 3) = 1.0;
+    T_basis_linear(dof_10, 3) = -1.0;
+    T_basis_linear(dof_01, 3) = 1.0;
+    T_basis_linear(dof_11, 3) = -1.0;
+
+    return T_basis_linear;
+}
+
+DynMatrix<double> Legendre_2D::GetLinearBasisT(const uint p) {
+    uint ndof_1D  = p + 1;
+    uint ndof_lin = 4;
+
+    DynMatrix<double> T_linear_basis(ndof_lin, ndof_1D * ndof_1D);
+
+    set_constant(T_linear_basis, 0.0);
+
+    const uint dof_00 = 0;
+    const uint dof_01 = 1;
+    const uint dof_10 = ndof_1D;
+    const uint dof_11 = ndof_1D + 1;
+
+    T_linear_basis(0, dof_00) = 1.0 / 4.0;
+    T_linear_basis(1, dof_00) = 1.0 / 4.0;
+    T_linear_basis(2, dof_00) = 1.0 / 4.0;
+    T_linear_basis(3, dof_00) = 1.0 / 4.0;
+
+    T_linear_basis(0, dof_10) = -1.0 / 4.0;
+    T_linear_basis(1, dof_10) = 1.0 / 4.0;
+    T_linear_basis(2, dof_10) = 1.0 / 4.0;
+    T_linear_basis(3, dof_10) = -1.0 / 4.0;
+
+    T_linear_basis(0, dof_01) = -1.0 / 4.0;
+    T_linear_basis(1, dof_01) = -1.0 / 4.0;
+    T_linear_basis(2, dof_01) = 1.0 / 4.0;
+    T_linear_basis(3, dof_01) = 1.0 / 4.0;
+
+    T_linear_basis(0, dof_11) = 1.0 / 4.0;
+    T_linear_basis(1, dof_11) = -1.0 / 4.0;
+    T_linear_basis(2, dof_11) = 1.0 / 4.0;
+    T_linear_basis(3, dof_11) = -1.0 / 4.0;
+
+    return T_linear_basis;
+}
+
+AlignedVector<Point<1>> Legendre_2D::GetLineCoordinates(const uint coord, const AlignedVector<Point<2>>& points) {
+    AlignedVector<Point<1>> line_points(points.size());
+
+    for (uint pt = 0; pt < points.size(); ++pt) {
+        line_points[pt][LocalCoordLin::l1] = points[pt][coord];
+    }
+
+    return line_points;
+}
+}
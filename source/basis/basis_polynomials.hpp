@@ -25,6 +25,16 @@ DynVector<double> jacobi_polynomial(const uint n, const uint a, const uint b, co
  * @return Jacobi polynomial's derivate evaluation at the points x
  */
 DynVector<double> jacobi_polynomial_derivative(const uint n, const uint a, const uint b, const std::vector<double>& x);
+
+/**
+ * Compute the n + 1 Gauss-Lobatto-Legendre points on [-1, 1]
+ * The interior points are the roots of P<sub>n-1</sub><sup>(1,1)</sup>, found by Newton iteration starting
+ * from the Chebyshev-Gauss-Lobatto points.
+ *
+ * @param n
+ * @return Gauss-Lobatto-Legendre points in ascending order
+ */
+std::vector<double> gauss_lobatto_points(const uint n);
 }
 
 #endif
\ No newline at end of file
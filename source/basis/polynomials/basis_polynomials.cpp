@@ -65,4 +65,35 @@ DynVector<double> jacobi_polynomial_derivative(const uint n, const uint a, const
 
     return dP;
 }
+
+std::vector<double> gauss_lobatto_points(const uint n) {
+    std::vector<double> x(n + 1);
+
+    for (uint pt = 0; pt <= n; ++pt) {
+        x[pt] = -std::cos(PI * pt / n);
+    }
+
+    std::vector<double> x_interior(x.begin() + 1, x.end() - 1);
+
+    for (uint iter = 0; iter < 100; ++iter) {
+        DynVector<double> P  = jacobi_polynomial(n - 1, 1, 1, x_interior);
+        DynVector<double> dP = jacobi_polynomial_derivative(n - 1, 1, 1, x_interior);
+
+        double max_dx = 0.0;
+        for (uint pt = 0; pt < x_interior.size(); ++pt) {
+            double dx = P[pt] / dP[pt];
+
+            x_interior[pt] -= dx;
+            max_dx = std::max(max_dx, std::abs(dx));
+        }
+
+        if (max_dx < 1.0e-15) {
+            break;
+        }
+    }
+
+    std::copy(x_interior.begin(), x_interior.end(), x.begin() + 1);
+
+    return x;
+}
 }
\ No newline at end of file
@@ -3,6 +3,27 @@
 
 #include "general_definitions.hpp"
 
+// Non-owning view of a message inside a send or receive buffer
+template <typename T>
+class MessageView {
+  private:
+    T* message;
+    uint length;
+
+  public:
+    MessageView(T* message, const uint length) : message(message), length(length) {}
+
+    T& operator[](const uint index) const {
+        assert(index < this->length);
+        return this->message[index];
+    }
+
+    uint size() const { return this->length; }
+
+    T* begin() const { return this->message; }
+    T* end() const { return this->message + this->length; }
+};
+
 class DBDataExchanger {
   public:
     const uint locality_in;
@@ -26,8 +47,8 @@ class DBDataExchanger {
                     std::vector<std::vector<double>>& send_buffer,
                     std::vector<std::vector<double>>& receive_buffer);
 
-    void SetToSendBuffer(const uint comm_type, const std::vector<double>& message);
-    void GetFromReceiveBuffer(const uint comm_type, std::vector<double>& message);
+    MessageView<double> GetSendMessage(const uint comm_type, const uint message_size);
+    MessageView<const double> GetReceiveMessage(const uint comm_type, const uint message_size) const;
 };
 
 DBDataExchanger::DBDataExchanger(const uint locality_in,
@@ -45,14 +66,16 @@ DBDataExchanger::DBDataExchanger(const uint locality_in,
       send_buffer(send_buffer),
       receive_buffer(receive_buffer) {}
 
-void DBDataExchanger::SetToSendBuffer(const uint comm_type, const std::vector<double>& message) {
-    std::copy(message.begin(), message.end(), this->send_buffer[comm_type].begin() + this->offset[comm_type]);
+MessageView<double> DBDataExchanger::GetSendMessage(const uint comm_type, const uint message_size) {
+    assert(this->offset[comm_type] + message_size <= this->send_buffer[comm_type].size());
+
+    return MessageView<double>(this->send_buffer[comm_type].data() + this->offset[comm_type], message_size);
 }
 
-void DBDataExchanger::GetFromReceiveBuffer(const uint comm_type, std::vector<double>& message) {
-    std::copy(this->receive_buffer[comm_type].begin() + this->offset[comm_type],
-              this->receive_buffer[comm_type].begin() + this->offset[comm_type] + message.size(),
-              message.begin());
+MessageView<const double> DBDataExchanger::GetReceiveMessage(const uint comm_type, const uint message_size) const {
+    assert(this->offset[comm_type] + message_size <= this->receive_buffer[comm_type].size());
+
+    return MessageView<const double>(this->receive_buffer[comm_type].data() + this->offset[comm_type], message_size);
 }
 
 #endif
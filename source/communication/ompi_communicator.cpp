@@ -1,26 +1,83 @@
 #include "ompi_communicator.hpp"
 
-OMPICommunicator::OMPICommunicator(const DistributedBoundaryMetaData& db_data) {
+#include <thread>
+
+OMPICommunicator::OMPICommunicator(const DistributedBoundaryMetaData& db_data, const OMPISubmeshMap& submesh_map) {
     for (auto& rb_meta_data : db_data.rank_boundary_data) {
         OMPIRankBoundary rank_boundary;
 
         rank_boundary.db_data = rb_meta_data;
 
-        rank_boundary.send_rank    = rb_meta_data.locality_ex;
-        rank_boundary.receive_rank = rb_meta_data.locality_ex;
+        this->rank_boundaries.push_back(std::move(rank_boundary));
+    }
 
-        rank_boundary.send_tag =
-            (int)((unsigned short)rb_meta_data.submesh_in << 16 | (unsigned short)rb_meta_data.submesh_ex);
-        rank_boundary.receive_tag =
-            (int)((unsigned short)rb_meta_data.submesh_ex << 16 | (unsigned short)rb_meta_data.submesh_in);
+    this->Route(submesh_map);
+}
 
-        this->rank_boundaries.push_back(std::move(rank_boundary));
+void OMPICommunicator::Route(const OMPISubmeshMap& submesh_map) {
+    this->mpi_rank_boundary_ids.clear();
+    this->shared_rank_boundary_ids.clear();
+
+    for (uint rank_boundary_id = 0; rank_boundary_id < this->rank_boundaries.size(); ++rank_boundary_id) {
+        OMPIRankBoundary& rank_boundary          = this->rank_boundaries[rank_boundary_id];
+        const RankBoundaryMetaData& rb_meta_data = rank_boundary.db_data;
+
+        const uint id_in = submesh_map.GetGlobalId(rb_meta_data.locality_in, rb_meta_data.submesh_in);
+        const uint id_ex = submesh_map.GetGlobalId(rb_meta_data.locality_ex, rb_meta_data.submesh_ex);
+
+        rank_boundary.send_rank    = submesh_map.rank[id_ex];
+        rank_boundary.receive_rank = submesh_map.rank[id_ex];
+
+        rank_boundary.send_tag    = (int)((unsigned short)id_in << 16 | (unsigned short)id_ex);
+        rank_boundary.receive_tag = (int)((unsigned short)id_ex << 16 | (unsigned short)id_in);
+
+        rank_boundary.shared = (submesh_map.rank[id_in] == submesh_map.rank[id_ex]);
+
+        rank_boundary.send_channel.clear();
+        rank_boundary.receive_channel.clear();
+
+        if (rank_boundary.shared) {
+            this->shared_rank_boundary_ids.push_back(rank_boundary_id);
+        } else {
+            this->mpi_rank_boundary_ids.push_back(rank_boundary_id);
+        }
     }
 }
 
+void OMPICommunicator::Remap(const OMPISubmeshMap& submesh_map) {
+    for (auto& requests : this->send_requests) {
+        for (MPI_Request& request : requests) {
+            MPI_Request_free(&request);
+        }
+    }
+
+    for (auto& requests : this->receive_requests) {
+        for (MPI_Request& request : requests) {
+            MPI_Request_free(&request);
+        }
+    }
+
+    this->send_requests.clear();
+    this->receive_requests.clear();
+
+    this->Route(submesh_map);
+
+    this->InitializeCommunication();
+}
+
+void OMPICommunicator::SetSinglePrecision(const uint comm_type) {
+    if (this->single_precision.size() <= comm_type) {
+        this->single_precision.resize(comm_type + 1, false);
+    }
+
+    this->single_precision[comm_type] = true;
+}
+
 void OMPICommunicator::InitializeCommunication() {
     uint ncomm   = this->rank_boundaries.begin()->send_buffer.size();
-    uint nrbound = this->rank_boundaries.size();
+    uint nrbound = this->mpi_rank_boundary_ids.size();
+
+    this->single_precision.resize(ncomm, false);
 
     this->send_requests.resize(ncomm);
     this->receive_requests.resize(ncomm);
@@ -30,14 +87,40 @@ void OMPICommunicator::InitializeCommunication() {
         this->receive_requests[comm].resize(nrbound);
     }
 
-    for (uint rank_boundary_id = 0; rank_boundary_id < this->rank_boundaries.size(); ++rank_boundary_id) {
-        OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+    for (uint mpi_rb_id = 0; mpi_rb_id < nrbound; ++mpi_rb_id) {
+        OMPIRankBoundary& rank_boundary = this->rank_boundaries[this->mpi_rank_boundary_ids[mpi_rb_id]];
 
         uint ncomm = rank_boundary.send_buffer.size();
 
+        rank_boundary.send_buffer_sp.resize(ncomm);
+        rank_boundary.receive_buffer_sp.resize(ncomm);
+
         for (uint comm = 0; comm < ncomm; ++comm) {
-            MPI_Request& send_request    = this->send_requests[comm][rank_boundary_id];
-            MPI_Request& receive_request = this->receive_requests[comm][rank_boundary_id];
+            MPI_Request& send_request    = this->send_requests[comm][mpi_rb_id];
+            MPI_Request& receive_request = this->receive_requests[comm][mpi_rb_id];
+
+            if (this->single_precision[comm]) {
+                rank_boundary.send_buffer_sp[comm].resize(rank_boundary.send_buffer[comm].size());
+                rank_boundary.receive_buffer_sp[comm].resize(rank_boundary.receive_buffer[comm].size());
+
+                MPI_Send_init(&rank_boundary.send_buffer_sp[comm].front(),
+                              rank_boundary.send_buffer_sp[comm].size(),
+                              MPI_FLOAT,
+                              rank_boundary.send_rank,
+                              rank_boundary.send_tag,
+                              MPI_COMM_WORLD,
+                              &send_request);
+
+                MPI_Recv_init(&rank_boundary.receive_buffer_sp[comm].front(),
+                              rank_boundary.receive_buffer_sp[comm].size(),
+                              MPI_FLOAT,
+                              rank_boundary.receive_rank,
+                              rank_boundary.receive_tag,
+                              MPI_COMM_WORLD,
+                              &receive_request);
+
+                continue;
+            }
 
             MPI_Send_init(&rank_boundary.send_buffer[comm].front(),
                           rank_boundary.send_buffer[comm].size(),
@@ -56,21 +139,177 @@ void OMPICommunicator::InitializeCommunication() {
                           &receive_request);
         }
     }
+
+    for (uint rank_boundary_id : this->shared_rank_boundary_ids) {
+        OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+
+        uint ncomm = rank_boundary.send_buffer.size();
+
+        rank_boundary.send_channel.resize(ncomm);
+        rank_boundary.receive_channel.resize(ncomm, nullptr);
+
+        for (uint comm = 0; comm < ncomm; ++comm) {
+            rank_boundary.send_channel[comm] = std::make_unique<OMPISharedChannel>();
+
+            // slots have to be sized as the send buffer, since they are swapped into it
+            rank_boundary.send_channel[comm]->slot[0] = rank_boundary.send_buffer[comm];
+            rank_boundary.send_channel[comm]->slot[1] = rank_boundary.send_buffer[comm];
+        }
+    }
+}
+
+void OMPICommunicator::ConnectSharedBoundaries(std::vector<OMPICommunicator*>& communicators) {
+    for (OMPICommunicator* communicator : communicators) {
+        for (uint rank_boundary_id : communicator->shared_rank_boundary_ids) {
+            OMPIRankBoundary& rank_boundary = communicator->rank_boundaries[rank_boundary_id];
+
+            OMPIRankBoundary* peer_boundary = nullptr;
+
+            for (OMPICommunicator* peer_communicator : communicators) {
+                for (uint peer_boundary_id : peer_communicator->shared_rank_boundary_ids) {
+                    OMPIRankBoundary& candidate = peer_communicator->rank_boundaries[peer_boundary_id];
+
+                    if (candidate.db_data.locality_in == rank_boundary.db_data.locality_ex &&
+                        candidate.db_data.submesh_in == rank_boundary.db_data.submesh_ex &&
+                        candidate.db_data.locality_ex == rank_boundary.db_data.locality_in &&
+                        candidate.db_data.submesh_ex == rank_boundary.db_data.submesh_in) {
+                        peer_boundary = &candidate;
+                    }
+                }
+            }
+
+            if (!peer_boundary) {
+                throw std::logic_error("Fatal Error: unable to find submesh " +
+                                       std::to_string(rank_boundary.db_data.submesh_ex) + " sharing a boundary with " +
+                                       std::to_string(rank_boundary.db_data.submesh_in) + " on this rank\n");
+            }
+
+            for (uint comm = 0; comm < rank_boundary.receive_channel.size(); ++comm) {
+                assert(peer_boundary->send_buffer[comm].size() == rank_boundary.receive_buffer[comm].size());
+
+                rank_boundary.receive_channel[comm] = peer_boundary->send_channel[comm].get();
+            }
+        }
+    }
 }
 
 void OMPICommunicator::SendAll(const uint comm_type, const uint timestamp) {
-    MPI_Startall(this->send_requests[comm_type].size(), &this->send_requests[comm_type].front());
+    for (uint rank_boundary_id : this->shared_rank_boundary_ids) {
+        OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+        OMPISharedChannel& channel      = *rank_boundary.send_channel[comm_type];
+
+        const uint n_sent = channel.n_sent.load(std::memory_order_relaxed);
+
+        // do not overwrite a slot the receiver has not picked up yet
+        while (n_sent - channel.n_received.load(std::memory_order_acquire) >= 2) {
+            std::this_thread::yield();
+        }
+
+        std::swap(rank_boundary.send_buffer[comm_type], channel.slot[n_sent % 2]);
+
+        channel.n_sent.store(n_sent + 1, std::memory_order_release);
+    }
+
+    if (this->single_precision[comm_type]) {
+        for (uint rank_boundary_id : this->mpi_rank_boundary_ids) {
+            OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+
+            std::copy(rank_boundary.send_buffer[comm_type].begin(),
+                      rank_boundary.send_buffer[comm_type].end(),
+                      rank_boundary.send_buffer_sp[comm_type].begin());
+        }
+    }
+
+    if (!this->send_requests[comm_type].empty()) {
+        MPI_Startall(this->send_requests[comm_type].size(), &this->send_requests[comm_type].front());
+    }
 }
 
 void OMPICommunicator::ReceiveAll(const uint comm_type, const uint timestamp) {
-    MPI_Startall(this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front());
+    if (!this->receive_requests[comm_type].empty()) {
+        MPI_Startall(this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front());
+    }
 }
 
 void OMPICommunicator::WaitAllSends(const uint comm_type, const uint timestamp) {
-    MPI_Waitall(this->send_requests[comm_type].size(), &this->send_requests[comm_type].front(), MPI_STATUSES_IGNORE);
+    if (!this->send_requests[comm_type].empty()) {
+        MPI_Waitall(
+            this->send_requests[comm_type].size(), &this->send_requests[comm_type].front(), MPI_STATUSES_IGNORE);
+    }
 }
 
 void OMPICommunicator::WaitAllReceives(const uint comm_type, const uint timestamp) {
-    MPI_Waitall(
-        this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front(), MPI_STATUSES_IGNORE);
-}
\ No newline at end of file
+    for (uint rank_boundary_id : this->shared_rank_boundary_ids) {
+        OMPISharedChannel& channel = *this->rank_boundaries[rank_boundary_id].receive_channel[comm_type];
+
+        while (channel.n_sent.load(std::memory_order_acquire) == channel.n_received.load(std::memory_order_relaxed)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (!this->receive_requests[comm_type].empty()) {
+        MPI_Waitall(
+            this->receive_requests[comm_type].size(), &this->receive_requests[comm_type].front(), MPI_STATUSES_IGNORE);
+    }
+
+    this->CompleteReceives(comm_type);
+}
+
+bool OMPICommunicator::TestAllSends(const uint comm_type, const uint timestamp) {
+    int sent = true;
+
+    if (!this->send_requests[comm_type].empty()) {
+        MPI_Testall(
+            this->send_requests[comm_type].size(), &this->send_requests[comm_type].front(), &sent, MPI_STATUSES_IGNORE);
+    }
+
+    return sent;
+}
+
+bool OMPICommunicator::TestAllReceives(const uint comm_type, const uint timestamp) {
+    for (uint rank_boundary_id : this->shared_rank_boundary_ids) {
+        OMPISharedChannel& channel = *this->rank_boundaries[rank_boundary_id].receive_channel[comm_type];
+
+        if (channel.n_sent.load(std::memory_order_acquire) == channel.n_received.load(std::memory_order_relaxed)) {
+            return false;
+        }
+    }
+
+    int received = true;
+
+    if (!this->receive_requests[comm_type].empty()) {
+        MPI_Testall(this->receive_requests[comm_type].size(),
+                    &this->receive_requests[comm_type].front(),
+                    &received,
+                    MPI_STATUSES_IGNORE);
+    }
+
+    if (received) {
+        this->CompleteReceives(comm_type);
+    }
+
+    return received;
+}
+
+void OMPICommunicator::CompleteReceives(const uint comm_type) {
+    for (uint rank_boundary_id : this->shared_rank_boundary_ids) {
+        OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+        OMPISharedChannel& channel      = *rank_boundary.receive_channel[comm_type];
+
+        const uint n_received = channel.n_received.load(std::memory_order_relaxed);
+
+        std::swap(rank_boundary.receive_buffer[comm_type], channel.slot[n_received % 2]);
+
+        channel.n_received.store(n_received + 1, std::memory_order_release);
+    }
+
+    if (this->single_precision[comm_type]) {
+        for (uint rank_boundary_id : this->mpi_rank_boundary_ids) {
+            OMPIRankBoundary& rank_boundary = this->rank_boundaries[rank_boundary_id];
+
+            std::copy(rank_boundary.receive_buffer_sp[comm_type].begin(),
+                      rank_boundary.receive_buffer_sp[comm_type].end(),
+                      rank_boundary.receive_buffer[comm_type].begin());
+        }
+    }
+}
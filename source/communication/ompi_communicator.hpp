@@ -3,9 +3,43 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+
 #include "general_definitions.hpp"
 #include "preprocessor/mesh_metadata.hpp"
 
+// Channel between two submeshes residing on the same MPI rank. Messages are handed over by swapping
+// the sender's send buffer into one of two slots and the slot into the receiver's receive buffer,
+// hence no data is copied and no MPI calls are made. Two slots allow the sender to run one round ahead.
+struct OMPISharedChannel {
+    std::array<std::vector<double>, 2> slot;
+
+    std::atomic<uint> n_sent{0};
+    std::atomic<uint> n_received{0};
+};
+
+// Ranks on which submeshes reside, submeshes being identified by the locality and id they were partitioned to.
+// These differ once submeshes have been moved between ranks.
+struct OMPISubmeshMap {
+    std::vector<uint> offset;  // global id of the first submesh of a locality, with one past the last appended
+    std::vector<int> rank;     // indexed by global id
+
+    uint GetGlobalId(const uint locality_id, const uint submesh_id) const {
+        return this->offset[locality_id] + submesh_id;
+    }
+    int GetRank(const uint locality_id, const uint submesh_id) const {
+        return this->rank[this->GetGlobalId(locality_id, submesh_id)];
+    }
+    uint GetLocalityId(const uint global_id) const {
+        auto next_locality = std::upper_bound(this->offset.begin(), this->offset.end(), global_id);
+
+        return std::distance(this->offset.begin(), next_locality) - 1;
+    }
+};
+
 struct OMPIRankBoundary {
     RankBoundaryMetaData db_data;
 
@@ -17,20 +51,39 @@ struct OMPIRankBoundary {
 
     std::vector<std::vector<double>> send_buffer;
     std::vector<std::vector<double>> receive_buffer;
+
+    // wire buffers for communications sent in single precision
+    std::vector<std::vector<float>> send_buffer_sp;
+    std::vector<std::vector<float>> receive_buffer_sp;
+
+    // set if the neighboring submesh lives on this rank
+    bool shared = false;
+
+    std::vector<std::unique_ptr<OMPISharedChannel>> send_channel;
+    std::vector<OMPISharedChannel*> receive_channel;
 };
 
 class OMPICommunicator {
   private:
     std::vector<OMPIRankBoundary> rank_boundaries;
 
+    std::vector<uint> mpi_rank_boundary_ids;
+    std::vector<uint> shared_rank_boundary_ids;
+
+    std::vector<bool> single_precision;
+
     std::vector<std::vector<MPI_Request>> send_requests;
     std::vector<std::vector<MPI_Request>> receive_requests;
 
   public:
     OMPICommunicator() = default;
-    OMPICommunicator(const DistributedBoundaryMetaData& db_data);
+    OMPICommunicator(const DistributedBoundaryMetaData& db_data, const OMPISubmeshMap& submesh_map);
 
+    void SetSinglePrecision(const uint comm_type);
     void InitializeCommunication();
+    // reroutes rank boundaries after submeshes have moved, all communication must have completed
+    void Remap(const OMPISubmeshMap& submesh_map);
+    static void ConnectSharedBoundaries(std::vector<OMPICommunicator*>& communicators);
 
     uint GetRankBoundaryNumber() { return this->rank_boundaries.size(); }
     OMPIRankBoundary& GetRankBoundary(const uint rank_boundary_id) {
@@ -42,6 +95,14 @@ class OMPICommunicator {
     void WaitAllSends(const uint comm_type, const uint timestamp);
     void WaitAllReceives(const uint comm_type, const uint timestamp);
 
+    // non-blocking counterparts of WaitAll*, receives are completed if true is returned
+    bool TestAllSends(const uint comm_type, const uint timestamp);
+    bool TestAllReceives(const uint comm_type, const uint timestamp);
+
+  private:
+    void Route(const OMPISubmeshMap& submesh_map);
+    void CompleteReceives(const uint comm_type);
+
   public:
     using RankBoundaryType = OMPIRankBoundary;
 };
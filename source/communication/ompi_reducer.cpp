@@ -0,0 +1,136 @@
+#include "ompi_reducer.hpp"
+
+#include <limits>
+
+namespace {
+void reduce_pairs(void* in, void* inout, int* len, MPI_Datatype*) {
+    const double* in_pair = (const double*)in;
+    double* inout_pair    = (double*)inout;
+
+    for (int i = 0; i < *len; ++i, in_pair += 2, inout_pair += 2) {
+        if ((ReductionOp)(uchar)inout_pair[0] == ReductionOp::sum) {
+            inout_pair[1] += in_pair[1];
+        } else {
+            inout_pair[1] = std::max(inout_pair[1], in_pair[1]);
+        }
+    }
+}
+
+MPI_Datatype pair_type() {
+    static MPI_Datatype type = []() {
+        MPI_Datatype type;
+        MPI_Type_contiguous(2, MPI_DOUBLE, &type);
+        MPI_Type_commit(&type);
+        return type;
+    }();
+
+    return type;
+}
+
+MPI_Op pair_op() {
+    static MPI_Op op = []() {
+        MPI_Op op;
+        MPI_Op_create(&reduce_pairs, 1, &op);
+        return op;
+    }();
+
+    return op;
+}
+}
+
+uint OMPIReducer::AddScalar(const ReductionOp op) {
+    this->ops.push_back(op);
+
+    this->ResetLocal();
+
+    return this->ops.size() - 1;
+}
+
+void OMPIReducer::SetContributors(const uint n_contributors) {
+    this->n_contributors = n_contributors;
+}
+
+void OMPIReducer::Contribute(const uint scalar_id, const double value) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    double& local = this->local[2 * scalar_id + 1];
+
+    if (this->ops[scalar_id] == ReductionOp::sum) {
+        local += value;
+    } else {
+        local = std::max(local, value);
+    }
+}
+
+void OMPIReducer::Arrive() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    // ranks without contributors still take part in every round, their arrival is left to the driver
+    if (this->ops.empty() || ++this->n_arrived < this->n_contributors) {
+        return;
+    }
+
+    this->CompleteRound();
+
+    this->n_arrived = 0;
+
+    std::swap(this->send_buffer, this->local);
+    this->receive_buffer.resize(this->send_buffer.size());
+
+    this->ResetLocal();
+
+    MPI_Iallreduce(this->send_buffer.data(),
+                   this->receive_buffer.data(),
+                   this->ops.size(),
+                   pair_type(),
+                   pair_op(),
+                   MPI_COMM_WORLD,
+                   &this->request);
+}
+
+void OMPIReducer::Complete() {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    this->CompleteRound();
+}
+
+bool OMPIReducer::GetResult(std::vector<double>& result) {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    if (this->results.empty()) {
+        return false;
+    }
+
+    result = std::move(this->results.front());
+
+    this->results.pop_front();
+
+    return true;
+}
+
+void OMPIReducer::ResetLocal() {
+    this->local.resize(2 * this->ops.size());
+
+    for (uint scalar_id = 0; scalar_id < this->ops.size(); ++scalar_id) {
+        this->local[2 * scalar_id]     = (uchar)this->ops[scalar_id];
+        this->local[2 * scalar_id + 1] = (this->ops[scalar_id] == ReductionOp::sum)
+                                             ? 0.0
+                                             : std::numeric_limits<double>::lowest();
+    }
+}
+
+void OMPIReducer::CompleteRound() {
+    if (this->request == MPI_REQUEST_NULL) {
+        return;
+    }
+
+    MPI_Wait(&this->request, MPI_STATUS_IGNORE);
+
+    std::vector<double> result(this->ops.size());
+
+    for (uint scalar_id = 0; scalar_id < this->ops.size(); ++scalar_id) {
+        result[scalar_id] = this->receive_buffer[2 * scalar_id + 1];
+    }
+
+    this->results.push_back(std::move(result));
+}
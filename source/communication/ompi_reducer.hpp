@@ -0,0 +1,53 @@
+#ifndef OMPI_REDUCER_HPP
+#define OMPI_REDUCER_HPP
+
+#include <mpi.h>
+
+#include <deque>
+#include <mutex>
+
+#include "general_definitions.hpp"
+
+enum class ReductionOp : uchar { sum = 0, max = 1 };
+
+// Global reductions of scalars contributed by the sim units of a rank. A round collects contributions until
+// all sim units of the rank arrived, the last one to arrive starts a single non-blocking MPI_Iallreduce for
+// all scalars of the round. A round is completed once the next one starts, hence results lag one round behind
+// but are obtained without waiting on other ranks. Results are queued until obtained, in the order of rounds.
+class OMPIReducer {
+  private:
+    std::vector<ReductionOp> ops;
+
+    uint n_contributors = 0;
+    uint n_arrived      = 0;
+
+    // (op, value) pairs, such that a single message is reduced with a different op for each scalar
+    std::vector<double> local;
+    std::vector<double> send_buffer;
+    std::vector<double> receive_buffer;
+
+    std::deque<std::vector<double>> results;
+
+    MPI_Request request = MPI_REQUEST_NULL;
+
+    std::mutex mutex;
+
+  public:
+    // scalars are registered before the first round
+    uint AddScalar(const ReductionOp op);
+    void SetContributors(const uint n_contributors);
+
+    void Contribute(const uint scalar_id, const double value);
+    void Arrive();
+
+    // waits for the round in flight
+    void Complete();
+    // pops the result of the earliest completed round, returns false if there is none
+    bool GetResult(std::vector<double>& result);
+
+  private:
+    void ResetLocal();
+    void CompleteRound();
+};
+
+#endif
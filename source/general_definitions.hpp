@@ -19,6 +19,7 @@
 #include <array>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <tuple>
 #include <cstdlib>
@@ -36,7 +37,7 @@ template <typename T>
 using Array2D = std::vector<std::vector<T>>;
 
 #ifdef HAS_HPX
-//#include "simulation/hpx/load_balancer/serialization_headers.hpp"
+#include "simulation/hpx/load_balancer/serialization_headers.hpp"
 #endif
 
 namespace Basis {
@@ -75,16 +76,36 @@ class Basis {
 
     /**
      * Obtain the inverted mass matrix of basis functions of polynomial order p.
+     * Bases declaring is_orthogonal return a diagonal matrix, see Basis::get_minv.
      *
      * @param p polynomial order
-     * @param return a pair with a boolean, which states whether the basis is orthogonal,
-     *        and a 2-dimensional array corresponding to the mass matrix over the master element
+     * @param return a 2-dimensional array corresponding to the inverted mass matrix over the master element
      */
     virtual DynMatrix<double> GetMinv(const uint p) = 0;
 
     virtual DynMatrix<double> GetBasisLinearT(const uint p) = 0;
     virtual DynMatrix<double> GetLinearBasisT(const uint p) = 0;
 };
+
+/**
+ * Storage for the inverted mass matrix of a basis.
+ * For orthogonal bases only the diagonal is kept, which turns applying the inverted mass matrix into a scaling.
+ */
+template <typename BasisType>
+using MinvType = typename std::conditional<BasisType::is_orthogonal, DiagMatrix<double>, DynMatrix<double>>::type;
+
+inline DynMatrix<double> to_minv(DynMatrix<double>&& m_inv, std::false_type) {
+    return std::move(m_inv);
+}
+
+inline DiagMatrix<double> to_minv(DynMatrix<double>&& m_inv, std::true_type) {
+    return diagonal_matrix<double>(m_inv);
+}
+
+template <typename BasisType>
+MinvType<BasisType> get_minv(BasisType& basis, const uint p) {
+    return to_minv(basis.GetMinv(p), std::integral_constant<bool, BasisType::is_orthogonal>{});
+}
 }
 
 namespace Integration {
@@ -117,6 +138,21 @@ class Integration {
 }
 
 namespace Master {
+/**
+ * Master element basis traced onto one of its boundaries.
+ * Evaluated at the Gauss points of a boundary integration rule; the integration factors are given over the master
+ * boundary, i.e. they have to be scaled by the surface Jacobian of the actual boundary.
+ */
+template <uint dimension>
+struct TraceOperators {
+    DynMatrix<double> psi_gp;
+    DynMatrix<double> psi_bound_gp;
+    DynMatrix<double> phi_gp;
+
+    DynVector<double> int_fact;
+    DynMatrix<double> int_phi_fact;
+};
+
 template <uint dimension>
 class Master {
   public:
@@ -143,12 +179,22 @@ class Master {
 
     DynMatrix<double> int_phi_fact;
     std::array<DynMatrix<double>, dimension> int_dphi_fact;
-
-    DynMatrix<double> m_inv;
+#ifdef LEAN_AFFINE_ELEMENTS
+    DynMatrix<double> int_phi_phi_fact;
+    std::array<DynMatrix<double>, dimension> int_phi_dphi_fact;
+#endif
+#ifdef QUADRATURE_FREE_FLUX
+    DynMatrix<double> phi_nodal;                                   // phi_nodal(dof, node)
+    std::array<DynMatrix<double>, dimension> int_nodal_dphi_fact;  // integral of (nodal interpolant of u) * dphi
+#endif
 
     DynMatrix<double> phi_postprocessor_cell;
     DynMatrix<double> phi_postprocessor_point;
 
+    // shared by all interfaces and boundaries, keyed by bound_id and strength of the boundary integration rule
+    std::map<std::pair<uint, uint>, TraceOperators<dimension>> trace_operators;
+    std::mutex trace_operators_mutex;
+
   public:
     Master() = default;
     Master(const uint p) : p(p) {}
@@ -191,6 +237,12 @@ class Shape {
     Shape() = default;
     Shape(AlignedVector<Point<3>>&& nodal_coordinates) : nodal_coordinates(std::move(nodal_coordinates)) {}
 
+    // the virtual destructor suppresses the implicit moves, which elements rely on when being put into the mesh
+    Shape(const Shape&) = default;
+    Shape(Shape&&)      = default;
+    Shape& operator=(const Shape&) = default;
+    Shape& operator=(Shape&&) = default;
+
     virtual ~Shape() = default;
 
     virtual std::vector<uint> GetBoundaryNodeID(const uint bound_id, const std::vector<uint>& node_ID) const = 0;
@@ -247,6 +299,6 @@ enum LocalCoordTri : uchar { z1 = 0, z2 = 1, z3 = 2 };
 
 enum LocalCoordQuad : uchar { n1 = 0, n2 = 1, n3 = 2 };
 
-enum VTKElementTypes : uchar { straight_triangle = 5 };
+enum VTKElementTypes : uchar { straight_triangle = 5, straight_quadrilateral = 9 };
 
 #endif
@@ -23,13 +23,9 @@ class Boundary {
 
     AlignedVector<Point<dimension + 1>> gp_global_coordinates;
 
-    DynMatrix<double> psi_gp;
-    DynMatrix<double> psi_bound_gp;
-    DynMatrix<double> phi_gp;
+    const Master::TraceOperators<dimension + 1>* trace = nullptr;
 
-    DynVector<double> int_fact;
-    DynMatrix<double> int_phi_fact;
-    DynMatrix<double> int_phi_phi_fact;
+    double surface_J;
 
   public:
     template <typename... Args>
@@ -84,42 +80,18 @@ Boundary<dimension, IntegrationType, DataType, ConditonType>::Boundary(RawBounda
 
     uint ngp = integration_rule.first.size();
 
+    this->trace = &raw_boundary.template GetTraceOperators<IntegrationType>(2 * raw_boundary.p + 1);
+
     AlignedVector<Point<dimension + 1>> z_master =
         this->master.BoundaryToMasterCoordinates(this->bound_id, integration_rule.second);
 
     // Global coordinates of gps
     this->gp_global_coordinates = this->shape.LocalToGlobalCoordinates(z_master);
 
-    // Compute factors to expand nodal values
-    this->psi_gp = this->shape.GetPsi(z_master);
-
-    // Compute factors to expand boundary nodal values
-    this->psi_bound_gp = this->shape.GetBoundaryPsi(this->bound_id, integration_rule.second);
-
-    // Compute factors to expand modal values
-    this->phi_gp = raw_boundary.basis.GetPhi(raw_boundary.p, z_master);
-
     DynVector<double> surface_J = this->shape.GetSurfaceJ(this->bound_id, z_master);
 
     if (surface_J.size() == 1) {  // constant Jacobian
-        this->int_fact = integration_rule.first * surface_J[0];
-
-        this->int_phi_fact = transpose(this->phi_gp);
-        for (uint dof = 0; dof < this->master.ndof; ++dof) {
-            for (uint gp = 0; gp < ngp; ++gp) {
-                this->int_phi_fact(gp, dof) *= integration_rule.first[gp] * surface_J[0];
-            }
-        }
-
-        this->int_phi_phi_fact.resize(ngp, std::pow(this->master.ndof, 2));
-        for (uint dof_i = 0; dof_i < this->master.ndof; ++dof_i) {
-            for (uint dof_j = 0; dof_j < this->master.ndof; ++dof_j) {
-                uint lookup = this->master.ndof * dof_i + dof_j;
-                for (uint gp = 0; gp < ngp; ++gp) {
-                    this->int_phi_phi_fact(gp, lookup) = this->phi_gp(dof_i, gp) * this->int_phi_fact(gp, dof_j);
-                }
-            }
-        }
+        this->surface_J = surface_J[0];
 
         StatVector<double, dimension + 1> normal = this->shape.GetSurfaceNormal(this->bound_id, z_master)[0];
 
@@ -153,7 +125,7 @@ template <typename InputArrayType>
 inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonType>::ComputeUgp(
     const InputArrayType& u) {
     // u_gp(q, gp) = u(q, dof) * phi_gp(dof, gp)
-    return u * this->phi_gp;
+    return u * this->trace->phi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -161,7 +133,7 @@ template <typename InputArrayType>
 inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonType>::ComputeNodalUgp(
     const InputArrayType& u_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_nodal * this->psi_gp;
+    return u_nodal * this->trace->psi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -169,7 +141,7 @@ template <typename InputArrayType>
 inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonType>::ComputeBoundaryNodalUgp(
     const InputArrayType& u_bound_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_bound_nodal * this->psi_bound_gp;
+    return u_bound_nodal * this->trace->psi_bound_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -177,7 +149,7 @@ template <typename InputArrayType>
 inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonType>::Integration(
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_fact[gp]
-    return u_gp * this->int_fact;
+    return u_gp * (this->trace->int_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -186,7 +158,7 @@ inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonTyp
     const uint dof,
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * column(this->int_phi_fact, dof);
+    return u_gp * (column(this->trace->int_phi_fact, dof) * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -194,7 +166,7 @@ template <typename InputArrayType>
 inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonType>::IntegrationPhi(
     const InputArrayType& u_gp) {
     // integral(q, dof) =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * this->int_phi_fact;
+    return u_gp * (this->trace->int_phi_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename ConditonType>
@@ -203,8 +175,9 @@ inline decltype(auto) Boundary<dimension, IntegrationType, DataType, ConditonTyp
     const uint dof_i,
     const uint dof_j,
     const InputArrayType& u_gp) {
-    // integral[q] =  u_gp(q, gp) * int_phi_phi_fact(gp, lookup)
-    return u_gp * column(this->int_phi_phi_fact, this->master.ndof * dof_i + dof_j);
+    // integral[q] =  u_gp(q, gp) * phi_gp(dof_i, gp) * int_phi_fact(gp, dof_j)
+    return u_gp * vec_cw_mult(transpose(row(this->trace->phi_gp, dof_i)),
+                              column(this->trace->int_phi_fact, dof_j) * this->surface_J);
 }
 }
 
@@ -19,7 +19,7 @@ class EdgeBoundary {
     DynMatrix<double> int_lambda_lambda_fact;
     DynMatrix<double> int_phi_lambda_fact;
 
-    DynMatrix<double> m_inv;
+    Basis::MinvType<BasisType> m_inv;
 
   public:
     EdgeBoundary(BoundaryType& boundary, const bool ccw = true);
@@ -102,12 +102,12 @@ EdgeBoundary<dimension, BasisType, EdgeDataType, BoundaryType>::EdgeBoundary(Bou
                 uint lookup = ndof * dof_i + dof_j;
                 for (uint gp = 0; gp < ngp; ++gp) {
                     this->int_phi_lambda_fact(gp, lookup) =
-                        this->boundary.phi_gp(dof_i, gp) * this->int_lambda_fact(gp, dof_j);
+                        this->boundary.trace->phi_gp(dof_i, gp) * this->int_lambda_fact(gp, dof_j);
                 }
             }
         }
 
-        this->m_inv = basis.GetMinv(this->boundary.GetMaster().p) / surface_J[0];
+        this->m_inv = Basis::get_minv(basis, this->boundary.GetMaster().p) * (1.0 / surface_J[0]);
     }
 
     this->edge_data.set_ndof(ndof);
@@ -20,7 +20,7 @@ class EdgeInterface {
     DynMatrix<double> int_phi_lambda_fact_in;
     DynMatrix<double> int_phi_lambda_fact_ex;
 
-    DynMatrix<double> m_inv;
+    Basis::MinvType<BasisType> m_inv;
 
   public:
     EdgeInterface(InterfaceType& interface, const bool ccw = true);
@@ -108,7 +108,7 @@ EdgeInterface<dimension, BasisType, EdgeDataType, InterfaceType>::EdgeInterface(
                 uint lookup = ndof * dof_i + dof_j;
                 for (uint gp = 0; gp < ngp; ++gp) {
                     this->int_phi_lambda_fact_in(gp, lookup) =
-                        this->interface.phi_gp_in(dof_i, gp) * this->int_lambda_fact(gp, dof_j);
+                        this->interface.trace_in->phi_gp(dof_i, gp) * this->int_lambda_fact(gp, dof_j);
                 }
             }
         }
@@ -121,12 +121,12 @@ EdgeInterface<dimension, BasisType, EdgeDataType, InterfaceType>::EdgeInterface(
                 for (uint gp = 0; gp < ngp; ++gp) {
                     uint gp_ex = ngp - gp - 1;
                     this->int_phi_lambda_fact_ex(gp, lookup) =
-                        this->interface.phi_gp_ex(dof_i, gp) * this->int_lambda_fact(gp_ex, dof_j);
+                        this->interface.trace_ex->phi_gp(dof_i, gp) * this->int_lambda_fact(gp_ex, dof_j);
                 }
             }
         }
 
-        this->m_inv = basis.GetMinv(p) / surface_J[0];
+        this->m_inv = Basis::get_minv(basis, p) * (1.0 / surface_J[0]);
     }
 
     this->edge_data.set_ndof(ndof);
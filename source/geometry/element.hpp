@@ -2,8 +2,38 @@
 #define CLASS_ELEMENT_HPP
 
 #include "general_definitions.hpp"
+#include "utilities/scratch_arena.hpp"
 
 namespace Geometry {
+#ifdef LEAN_AFFINE_ELEMENTS
+// Expression for sum_z u * op(z) * J_inv(z, dir) * scale, i.e. u times a master element derivative operator mapped
+// onto the element. Scalars go onto the operators, so that assigning the sum of products through noalias() evaluates
+// each product in place without summing the operators into a temporary first
+template <uint z>
+struct apply_J_inv {
+    template <typename ArrayType, typename OperatorType, typename JacobianType>
+    static decltype(auto) apply(const ArrayType& u,
+                                const OperatorType& op,
+                                const JacobianType& J_inv,
+                                const uint dir,
+                                const double scale = 1.0) {
+        return apply_J_inv<z - 1>::apply(u, op, J_inv, dir, scale) + u * (op(z) * (J_inv(z, dir) * scale));
+    }
+};
+
+template <>
+struct apply_J_inv<0> {
+    template <typename ArrayType, typename OperatorType, typename JacobianType>
+    static decltype(auto) apply(const ArrayType& u,
+                                const OperatorType& op,
+                                const JacobianType& J_inv,
+                                const uint dir,
+                                const double scale = 1.0) {
+        return u * (op(0) * (J_inv(0, dir) * scale));
+    }
+};
+#endif
+
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 class Element {
   public:
@@ -19,6 +49,8 @@ class Element {
     std::vector<uint> neighbor_ID;
     std::vector<uchar> boundary_type;
 
+    bool distributed_boundary;
+
     AlignedVector<Point<dimension>> gp_global_coordinates;
     AlignedVector<Point<dimension>> sp_global_coordinates;
 
@@ -30,6 +62,10 @@ class Element {
     /* chi_gp stored in master */  // linear basis
     /* phi_gp stroed in master */  // modal basis
 
+    double abs_det_J;
+    StatMatrix<double, dimension, dimension> J_inv;
+
+#ifndef LEAN_AFFINE_ELEMENTS  // otherwise master element operators are mapped onto the element on the fly
     /* dpsi_gp stored in shape */                      // nodal basis, i.e. shape functions
     std::array<DynMatrix<double>, dimension> dchi_gp;  // linear basis
     std::array<DynMatrix<double>, dimension> dphi_gp;  // modal basis
@@ -40,7 +76,12 @@ class Element {
     std::array<DynMatrix<double>, dimension> int_dphi_fact;
     std::array<DynMatrix<double>, dimension> int_phi_dphi_fact;
 
-    DynMatrix<double> m_inv;
+    typename MasterType::MinvType m_inv;
+
+#ifdef QUADRATURE_FREE_FLUX
+    std::array<DynMatrix<double>, dimension> int_nodal_dphi_fact;
+#endif
+#endif
 
   public:
     Element() = default;
@@ -56,13 +97,13 @@ class Element {
     const ShapeType& GetShape() { return this->shape; }
     const std::vector<uint>& GetNodeID() { return this->node_ID; }
     const std::vector<uchar>& GetBoundaryType() { return this->boundary_type; }
+    bool HasDistributedBoundary() { return this->distributed_boundary; }
 
     void SetMaster(MasterType& master) { this->master = &master; };
     void SetSurveyPoints(const AlignedVector<Point<dimension>>& survey_points);
 
     void Initialize();
-    void CreateRawBoundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundary<dimension - 1, DataType>>>&
-                                 pre_specialized_interfaces);
+    void CreateRawBoundaries(std::map<uchar, RawBoundaryTable<dimension - 1, DataType>>& raw_boundaries);
 
     template <typename F>
     DynMatrix<double> L2ProjectionF(const F& f);
@@ -115,6 +156,20 @@ class Element {
     template <typename InputArrayType>
     decltype(auto) ApplyMinv(const InputArrayType& rhs);
 
+#ifdef QUADRATURE_FREE_FLUX
+    template <typename InputArrayType>
+    decltype(auto) ComputeUnodal(const InputArrayType& u);
+    template <typename InputArrayType>
+    decltype(auto) IntegrationNodalDPhi(const uint dir, const InputArrayType& u_nodal);
+#endif
+
+  private:
+    template <typename InputArrayType>
+    decltype(auto) IntegrationDPhi(std::false_type, const uint dir, const InputArrayType& u_gp);
+    template <typename InputArrayType>
+    DynMatrixMap<double> IntegrationDPhi(std::true_type, const uint dir, const InputArrayType& u_gp);
+
+  public:
     void InitializeVTK(AlignedVector<Point<3>>& points, Array2D<uint>& cells);
     template <typename InputArrayType, typename OutputArrayType>
     void WriteCellDataVTK(const InputArrayType& u, AlignedVector<OutputArrayType>& cell_data);
@@ -172,6 +227,10 @@ void Element<dimension, MasterType, ShapeType, DataType>::SetSurveyPoints(
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 void Element<dimension, MasterType, ShapeType, DataType>::Initialize() {
+    // ELEMENTS AT DISTRIBUTED BOUNDARIES REQUIRE DATA FROM OTHER SUBMESHES
+    this->distributed_boundary = std::any_of(
+        this->boundary_type.begin(), this->boundary_type.end(), [](uchar edge) { return is_distributed(edge); });
+
     // GLOBAL COORDINATES OF GPS
     this->gp_global_coordinates = this->shape.LocalToGlobalCoordinates(this->master->integration_rule.second);
 
@@ -187,6 +246,10 @@ void Element<dimension, MasterType, ShapeType, DataType>::Initialize() {
     this->shape.dpsi_gp = this->shape.GetDPsi(this->master->integration_rule.second);
 
     if (const_J) {  // constant Jacobian
+        this->abs_det_J = std::abs(det_J[0]);
+        this->J_inv     = J_inv[0];
+
+#ifndef LEAN_AFFINE_ELEMENTS
         // DIFFERENTIATION FACTORS
         this->dchi_gp = this->master->dchi_gp;
         for (uint dir = 0; dir < dimension; ++dir) {
@@ -257,8 +320,20 @@ void Element<dimension, MasterType, ShapeType, DataType>::Initialize() {
             }
         }
 
+#ifdef QUADRATURE_FREE_FLUX
+        this->int_nodal_dphi_fact = this->master->int_nodal_dphi_fact;
+        for (uint dir = 0; dir < dimension; ++dir) {
+            set_constant(this->int_nodal_dphi_fact[dir], 0.0);
+            for (uint z = 0; z < dimension; ++z) {
+                this->int_nodal_dphi_fact[dir] += this->master->int_nodal_dphi_fact[z] * J_inv[0](z, dir);
+            }
+            this->int_nodal_dphi_fact[dir] *= std::abs(det_J[0]);
+        }
+#endif
+
         // MASS MATRIX
-        this->m_inv = this->master->m_inv / std::abs(det_J[0]);
+        this->m_inv = this->master->m_inv * (1.0 / std::abs(det_J[0]));
+#endif
     } else {
         // Placeholder for nonconstant Jacobian
     }
@@ -272,7 +347,7 @@ void Element<dimension, MasterType, ShapeType, DataType>::Initialize() {
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 void Element<dimension, MasterType, ShapeType, DataType>::CreateRawBoundaries(
-    std::map<uchar, std::map<std::pair<uint, uint>, RawBoundary<dimension - 1, DataType>>>& raw_boundaries) {
+    std::map<uchar, RawBoundaryTable<dimension - 1, DataType>>& raw_boundaries) {
     // *** //
     auto* my_basis  = static_cast<Basis::Basis<dimension>*>(&this->master->basis);
     auto* my_master = static_cast<Master::Master<dimension>*>(this->master);
@@ -299,7 +374,12 @@ template <uint dimension, typename MasterType, typename ShapeType, typename Data
 template <typename F>
 DynMatrix<double> Element<dimension, MasterType, ShapeType, DataType>::L2ProjectionF(const F& f) {
     // projection(q, dof) = f_values(q, gp) * int_phi_fact(gp, dof) * m_inv(dof, dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    // |det J| cancels between int_phi_fact and m_inv
+    DynMatrix<double> projection = this->ComputeFgp(f) * this->master->int_phi_fact * this->master->m_inv;
+#else
     DynMatrix<double> projection = this->ComputeFgp(f) * this->int_phi_fact * this->m_inv;
+#endif
 
     return projection;
 }
@@ -309,7 +389,11 @@ template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::L2ProjectionNode(
     const InputArrayType& nodal_values) {
     // projection(q, dof) = nodal_values(q, node) * psi_gp(node, gp) * int_phi_fact(gp, dof) * m_inv(dof, dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return nodal_values * this->shape.psi_gp * this->master->int_phi_fact * this->master->m_inv;
+#else
     return nodal_values * this->shape.psi_gp * this->int_phi_fact * this->m_inv;
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -355,7 +439,7 @@ template <uint dimension, typename MasterType, typename ShapeType, typename Data
 template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::ComputeUgp(const InputArrayType& u) {
     // u_gp(q, gp) = u(q, dof) * phi_gp(dof, gp)
-    return u * this->master->phi_gp;
+    return this->master->ComputeUgp(u);
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -363,7 +447,12 @@ template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::ComputeDUgp(const uint dir,
                                                                                        const InputArrayType& u) {
     // du_gp(q, gp) = u(q, dof) * dphi_gp[dir](dof, gp)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return apply_J_inv<dimension - 1>::apply(
+        u, [this](const uint z) -> const DynMatrix<double>& { return this->master->dphi_gp[z]; }, this->J_inv, dir);
+#else
     return u * this->dphi_gp[dir];
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -380,7 +469,12 @@ inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::Compu
     const uint dir,
     const InputArrayType& u_lin) {
     // du_lin_gp(q, gp) = du(q, dof) * dchi_gp[dir](dof, gp)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return apply_J_inv<dimension - 1>::apply(
+        u_lin, [this](const uint z) -> const DynMatrix<double>& { return this->master->dchi_gp[z]; }, this->J_inv, dir);
+#else
     return u_lin * this->dchi_gp[dir];
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -425,7 +519,11 @@ template <uint dimension, typename MasterType, typename ShapeType, typename Data
 template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::Integration(const InputArrayType& u_gp) {
     // integral[q] = u_gp(q, gp) * this->int_fact[gp]
+#ifdef LEAN_AFFINE_ELEMENTS
+    return u_gp * (this->master->integration_rule.first * this->abs_det_J);
+#else
     return u_gp * this->int_fact;
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -433,14 +531,22 @@ template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::IntegrationPhi(const uint dof,
                                                                                           const InputArrayType& u_gp) {
     // integral[q] = u_gp(q, gp) * this->int_phi_fact(gp, dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return u_gp * (column(this->master->int_phi_fact, dof) * this->abs_det_J);
+#else
     return u_gp * column(this->int_phi_fact, dof);
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::IntegrationPhi(const InputArrayType& u_gp) {
     // integral(q, dof) = u_gp(q, gp) * this->int_phi_fact(gp, dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return u_gp * (this->master->int_phi_fact * this->abs_det_J);
+#else
     return u_gp * this->int_phi_fact;
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -450,7 +556,11 @@ inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::Integ
     const uint dof_j,
     const InputArrayType& u_gp) {
     // integral[q] = u_gp(q, gp) * this->int_phi_phi_fact(gp, lookup)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return u_gp * (column(this->master->int_phi_phi_fact, this->master->ndof * dof_i + dof_j) * this->abs_det_J);
+#else
     return u_gp * column(this->int_phi_phi_fact, this->master->ndof * dof_i + dof_j);
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -459,15 +569,64 @@ inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::Integ
                                                                                            const uint dof,
                                                                                            const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * this->int_dphi_fact[dir](gp. dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return apply_J_inv<dimension - 1>::apply(
+        u_gp,
+        [this, dof](const uint z) { return column(this->master->int_dphi_fact[z], dof); },
+        this->J_inv,
+        dir,
+        this->abs_det_J);
+#else
     return u_gp * column(this->int_dphi_fact[dir], dof);
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::IntegrationDPhi(const uint dir,
                                                                                            const InputArrayType& u_gp) {
+    return this->IntegrationDPhi(std::integral_constant<bool, MasterType::is_tensor_product>{}, dir, u_gp);
+}
+
+template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
+template <typename InputArrayType>
+inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::IntegrationDPhi(std::false_type,
+                                                                                           const uint dir,
+                                                                                           const InputArrayType& u_gp) {
     // integral(q, dof) =  u_gp(q, gp) * this->int_dphi_fact[dir](gp. dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return apply_J_inv<dimension - 1>::apply(
+        u_gp,
+        [this](const uint z) -> const DynMatrix<double>& { return this->master->int_dphi_fact[z]; },
+        this->J_inv,
+        dir,
+        this->abs_det_J);
+#else
     return u_gp * this->int_dphi_fact[dir];
+#endif
+}
+
+template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
+template <typename InputArrayType>
+DynMatrixMap<double> Element<dimension, MasterType, ShapeType, DataType>::IntegrationDPhi(std::true_type,
+                                                                                         const uint dir,
+                                                                                         const InputArrayType& u_gp) {
+    // integral(q, dof) = sum_z integral of u_gp(q, gp) * dphi_gp[z](dof, gp) * J_inv(z, dir) over the master element
+    const uint nvar = rows(u_gp);
+    const uint ndof = this->master->ndof;
+
+    DynMatrixMap<double> integral =
+        matrix_from_array(Utilities::ScratchArena::Local().Allocate<double>(nvar * ndof), nvar, ndof);
+
+    Utilities::ScratchArena::Scope scope;
+
+    integral = this->master->IntegrationDPhi(0, u_gp) * (this->J_inv(0, dir) * this->abs_det_J);
+
+    for (uint z = 1; z < dimension; ++z) {
+        integral += this->master->IntegrationDPhi(z, u_gp) * (this->J_inv(z, dir) * this->abs_det_J);
+    }
+
+    return integral;
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
@@ -478,16 +637,58 @@ inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::Integ
     const uint dof_j,
     const InputArrayType& u_gp) {
     // integral[q] = u_gp(q, gp) * this->int_phi_dphi_fact[dir_j](lookup, gp)
+#ifdef LEAN_AFFINE_ELEMENTS
+    const uint lookup = this->master->ndof * dof_i + dof_j;
+
+    return apply_J_inv<dimension - 1>::apply(
+        u_gp,
+        [this, lookup](const uint z) { return column(this->master->int_phi_dphi_fact[z], lookup); },
+        this->J_inv,
+        dir_j,
+        this->abs_det_J);
+#else
     return u_gp * column(this->int_phi_dphi_fact[dir_j], this->master->ndof * dof_i + dof_j);
+#endif
 }
 
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 template <typename InputArrayType>
 inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::ApplyMinv(const InputArrayType& rhs) {
     // solution(q, dof) = rhs(q, dof) * this->m_inv(dof, dof)
-    return rhs * this->m_inv;
+#ifdef LEAN_AFFINE_ELEMENTS
+    return rhs * (by_reference(this->master->m_inv) * (1.0 / this->abs_det_J));
+#else
+    return rhs * by_reference(this->m_inv);
+#endif
+}
+
+#ifdef QUADRATURE_FREE_FLUX
+template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
+template <typename InputArrayType>
+inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::ComputeUnodal(const InputArrayType& u) {
+    // u_nodal(q, node) = u(q, dof) * phi_nodal(dof, node)
+    return u * this->master->phi_nodal;
 }
 
+template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
+template <typename InputArrayType>
+inline decltype(auto) Element<dimension, MasterType, ShapeType, DataType>::IntegrationNodalDPhi(
+    const uint dir,
+    const InputArrayType& u_nodal) {
+    // integral(q, dof) = u_nodal(q, node) * this->int_nodal_dphi_fact[dir](node, dof)
+#ifdef LEAN_AFFINE_ELEMENTS
+    return apply_J_inv<dimension - 1>::apply(
+        u_nodal,
+        [this](const uint z) -> const DynMatrix<double>& { return this->master->int_nodal_dphi_fact[z]; },
+        this->J_inv,
+        dir,
+        this->abs_det_J);
+#else
+    return u_nodal * this->int_nodal_dphi_fact[dir];
+#endif
+}
+#endif
+
 template <uint dimension, typename MasterType, typename ShapeType, typename DataType>
 void Element<dimension, MasterType, ShapeType, DataType>::InitializeVTK(AlignedVector<Point<3>>& points,
                                                                         Array2D<uint>& cells) {
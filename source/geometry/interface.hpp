@@ -31,19 +31,10 @@ class Interface {
     AlignedVector<Point<dimension + 1>> gp_global_coordinates_in;
     AlignedVector<Point<dimension + 1>> gp_global_coordinates_ex;
 
-    DynMatrix<double> psi_gp_in;
-    DynMatrix<double> psi_gp_ex;
-    DynMatrix<double> psi_bound_gp_in;
-    DynMatrix<double> psi_bound_gp_ex;
-    DynMatrix<double> phi_gp_in;
-    DynMatrix<double> phi_gp_ex;
-
-    DynVector<double> int_fact_in;
-    DynVector<double> int_fact_ex;
-    DynMatrix<double> int_phi_fact_in;
-    DynMatrix<double> int_phi_fact_ex;
-    DynMatrix<double> int_phi_phi_fact_in;
-    DynMatrix<double> int_phi_phi_fact_ex;
+    const Master::TraceOperators<dimension + 1>* trace_in = nullptr;
+    const Master::TraceOperators<dimension + 1>* trace_ex = nullptr;
+
+    double surface_J;
 
   public:
     template <typename... Args>
@@ -128,6 +119,10 @@ Interface<dimension, IntegrationType, DataType, SpecializationType>::Interface(
 
     uint ngp = integration_rule.first.size();
 
+    // Operators on the master elements, the ex side is evaluated in the reverse gp order of the in side
+    this->trace_in = &raw_boundary_in.template GetTraceOperators<IntegrationType>(2 * p + 1);
+    this->trace_ex = &raw_boundary_ex.template GetTraceOperators<IntegrationType>(2 * p + 1);
+
     // transfrom gp to master coord in
     AlignedVector<Point<dimension + 1>> z_master_in =
         this->master_in.BoundaryToMasterCoordinates(this->bound_id_in, integration_rule.second);
@@ -135,15 +130,6 @@ Interface<dimension, IntegrationType, DataType, SpecializationType>::Interface(
     // Global coordinates of gps in
     this->gp_global_coordinates_in = this->shape_in.LocalToGlobalCoordinates(z_master_in);
 
-    // Compute factors to expand nodal values in
-    this->psi_gp_in = this->shape_in.GetPsi(z_master_in);
-
-    // Compute factors to expand boundary nodal values in
-    this->psi_bound_gp_in = this->shape_in.GetBoundaryPsi(this->bound_id_in, integration_rule.second);
-
-    // Compute factors to expand modal values in
-    this->phi_gp_in = raw_boundary_in.basis.GetPhi(raw_boundary_in.p, z_master_in);
-
     // transfrom gp to master coord ex
     AlignedVector<Point<dimension + 1>> z_master_ex =
         this->master_ex.BoundaryToMasterCoordinates(this->bound_id_ex, integration_rule.second);
@@ -151,57 +137,10 @@ Interface<dimension, IntegrationType, DataType, SpecializationType>::Interface(
     // Global coordinates of gps ex
     this->gp_global_coordinates_ex = this->shape_ex.LocalToGlobalCoordinates(z_master_ex);
 
-    // Compute factors to expand nodal values ex
-    this->psi_gp_ex = this->shape_ex.GetPsi(z_master_ex);
-
-    // Compute factors to expand boundary nodal values ex
-    this->psi_bound_gp_ex = this->shape_ex.GetBoundaryPsi(this->bound_id_ex, integration_rule.second);
-
-    // Compute factors to expand modal values ex
-    this->phi_gp_ex = raw_boundary_ex.basis.GetPhi(raw_boundary_ex.p, z_master_ex);
-
     DynVector<double> surface_J = this->shape_in.GetSurfaceJ(this->bound_id_in, z_master_in);
 
     if (surface_J.size() == 1) {  // constant Jacobian
-        this->int_fact_in = integration_rule.first * surface_J[0];
-
-        this->int_fact_ex = integration_rule.first * surface_J[0];
-
-        this->int_phi_fact_in = transpose(this->phi_gp_in);
-        for (uint dof = 0; dof < this->master_in.ndof; ++dof) {
-            for (uint gp = 0; gp < ngp; ++gp) {
-                this->int_phi_fact_in(gp, dof) *= integration_rule.first[gp] * surface_J[0];
-            }
-        }
-
-        this->int_phi_fact_ex = transpose(this->phi_gp_ex);
-        for (uint dof = 0; dof < this->master_ex.ndof; ++dof) {
-            for (uint gp = 0; gp < ngp; ++gp) {
-                this->int_phi_fact_ex(gp, dof) *= integration_rule.first[gp] * surface_J[0];
-            }
-        }
-
-        this->int_phi_phi_fact_in.resize(ngp, std::pow(this->master_in.ndof, 2));
-        for (uint dof_i = 0; dof_i < this->master_in.ndof; ++dof_i) {
-            for (uint dof_j = 0; dof_j < this->master_in.ndof; ++dof_j) {
-                uint lookup = this->master_in.ndof * dof_i + dof_j;
-                for (uint gp = 0; gp < ngp; ++gp) {
-                    this->int_phi_phi_fact_in(gp, lookup) =
-                        this->phi_gp_in(dof_i, gp) * this->int_phi_fact_in(gp, dof_j);
-                }
-            }
-        }
-
-        this->int_phi_phi_fact_ex.resize(ngp, std::pow(this->master_ex.ndof, 2));
-        for (uint dof_i = 0; dof_i < this->master_ex.ndof; ++dof_i) {
-            for (uint dof_j = 0; dof_j < this->master_ex.ndof; ++dof_j) {
-                uint lookup = this->master_ex.ndof * dof_i + dof_j;
-                for (uint gp = 0; gp < ngp; ++gp) {
-                    this->int_phi_phi_fact_ex(gp, lookup) =
-                        this->phi_gp_ex(dof_i, gp) * this->int_phi_fact_ex(gp, dof_j);
-                }
-            }
-        }
+        this->surface_J = surface_J[0];
 
         StatVector<double, dimension + 1> normal = this->shape_in.GetSurfaceNormal(this->bound_id_in, z_master_in)[0];
 
@@ -226,7 +165,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeUgpIN(
     const InputArrayType& u) {
     // u_gp(q, gp) = u(q, dof) * phi_gp(dof, gp)
-    return u * this->phi_gp_in;
+    return u * this->trace_in->phi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -249,7 +188,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeNodalUgpIN(
     const InputArrayType& u_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_nodal * this->psi_gp_in;
+    return u_nodal * this->trace_in->psi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -257,7 +196,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeBoundaryNodalUgpIN(
     const InputArrayType& u_bound_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_bound_nodal * this->psi_bound_gp_in;
+    return u_bound_nodal * this->trace_in->psi_bound_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -265,7 +204,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::IntegrationIN(
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_fact[gp]
-    return u_gp * this->int_fact_in;
+    return u_gp * (this->trace_in->int_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -274,7 +213,7 @@ inline decltype(auto) Interface<dimension, IntegrationType, DataType, Specializa
     const uint dof,
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * column(this->int_phi_fact_in, dof);
+    return u_gp * (column(this->trace_in->int_phi_fact, dof) * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -282,7 +221,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::IntegrationPhiIN(
     const InputArrayType& u_gp) {
     // integral(q, dof) =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * this->int_phi_fact_in;
+    return u_gp * (this->trace_in->int_phi_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -291,8 +230,9 @@ inline decltype(auto) Interface<dimension, IntegrationType, DataType, Specializa
     const uint dof_i,
     const uint dof_j,
     const InputArrayType& u_gp) {
-    // integral[q] =  u_gp(q, gp) * int_phi_phi_fact(gp, lookup)
-    return u_gp * column(this->int_phi_phi_fact_in, this->master_in.ndof * dof_i + dof_j);
+    // integral[q] =  u_gp(q, gp) * phi_gp(dof_i, gp) * int_phi_fact(gp, dof_j)
+    return u_gp * vec_cw_mult(transpose(row(this->trace_in->phi_gp, dof_i)),
+                              column(this->trace_in->int_phi_fact, dof_j) * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -300,7 +240,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeUgpEX(
     const InputArrayType& u) {
     // u_gp(q, gp) = u(q, dof) * phi_gp(dof, gp)
-    return u * this->phi_gp_ex;
+    return u * this->trace_ex->phi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -323,7 +263,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeNodalUgpEX(
     const InputArrayType& u_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_nodal * this->psi_gp_ex;
+    return u_nodal * this->trace_ex->psi_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -331,7 +271,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::ComputeBoundaryNodalUgpEX(
     const InputArrayType& u_bound_nodal) {
     // u_nodal_gp(q, gp) = u_nodal(q, dof) * psi_gp(dof, gp)
-    return u_bound_nodal * this->psi_bound_gp_ex;
+    return u_bound_nodal * this->trace_ex->psi_bound_gp;
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -339,7 +279,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::IntegrationEX(
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_fact[gp]
-    return u_gp * this->int_fact_ex;
+    return u_gp * (this->trace_ex->int_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -348,7 +288,7 @@ inline decltype(auto) Interface<dimension, IntegrationType, DataType, Specializa
     const uint dof,
     const InputArrayType& u_gp) {
     // integral[q] =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * column(this->int_phi_fact_ex, dof);
+    return u_gp * (column(this->trace_ex->int_phi_fact, dof) * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -356,7 +296,7 @@ template <typename InputArrayType>
 inline decltype(auto) Interface<dimension, IntegrationType, DataType, SpecializationType>::IntegrationPhiEX(
     const InputArrayType& u_gp) {
     // integral(q, dof) =  u_gp(q, gp) * int_phi_fact(gp, dof)
-    return u_gp * this->int_phi_fact_ex;
+    return u_gp * (this->trace_ex->int_phi_fact * this->surface_J);
 }
 
 template <uint dimension, typename IntegrationType, typename DataType, typename SpecializationType>
@@ -365,8 +305,9 @@ inline decltype(auto) Interface<dimension, IntegrationType, DataType, Specializa
     const uint dof_i,
     const uint dof_j,
     const InputArrayType& u_gp) {
-    // integral[q] =  u_gp(q, gp) * int_phi_phi_fact(gp, lookup)
-    return u_gp * column(this->int_phi_phi_fact_ex, this->master_ex.ndof * dof_i + dof_j);
+    // integral[q] =  u_gp(q, gp) * phi_gp(dof_i, gp) * int_phi_fact(gp, dof_j)
+    return u_gp * vec_cw_mult(transpose(row(this->trace_ex->phi_gp, dof_i)),
+                              column(this->trace_ex->int_phi_fact, dof_j) * this->surface_J);
 }
 }
 
@@ -3,6 +3,7 @@
 
 #include "general_definitions.hpp"
 #include "utilities/heterogeneous_containers.hpp"
+#include "utilities/scratch_arena.hpp"
 #include "mesh_utilities.hpp"
 
 namespace Geometry {
@@ -29,7 +30,7 @@ class Mesh<std::tuple<Elements...>,
   private:
     uint p;
 
-    MasterElementTypes masters;
+    typename master_maker<MasterElementTypes>::MasterPointerTypes masters;
     ElementContainer elements;
     InterfaceContainer interfaces;
     BoundaryContainer boundaries;
@@ -49,8 +50,17 @@ class Mesh<std::tuple<Elements...>,
     std::string GetMeshName() { return this->mesh_name; }
     void SetMeshName(const std::string& mesh_name) { this->mesh_name = mesh_name; }
 
-    const MasterElementTypes& GetMasters() { return this->masters; }
-    void SetMasters() { this->masters = master_maker<MasterElementTypes>::construct_masters(p); }
+    const typename master_maker<MasterElementTypes>::MasterPointerTypes& GetMasters() { return this->masters; }
+    // looks up the shared masters, e.g. after deserialization, and points elements to them
+    void SetMasters() {
+        this->masters = master_maker<MasterElementTypes>::construct_masters(p);
+
+        this->CallForEachElement([this](auto& elt) {
+            using MasterType = typename std::remove_reference<decltype(elt)>::type::ElementMasterType;
+
+            elt.SetMaster(*std::get<Utilities::index<MasterType, MasterElementTypes>::value>(this->masters));
+        });
+    }
 
     uint GetNumberElements() { return this->elements.size(); }
     uint GetNumberInterfaces() { return this->interfaces.size(); }
@@ -59,6 +69,9 @@ class Mesh<std::tuple<Elements...>,
 
     template <typename ElementType, typename... Args>
     void CreateElement(const uint ID, Args&&... args);
+    // constructs the elements make_element(ID, master) for all IDs concurrently
+    template <typename ElementType, typename F>
+    void CreateElements(const std::vector<uint>& IDs, const F& make_element);
     template <typename InterfaceType, typename... Args>
     void CreateInterface(Args&&... args);
     template <typename BoundaryType, typename... Args>
@@ -68,6 +81,11 @@ class Mesh<std::tuple<Elements...>,
 
     template <typename F>
     void CallForEachElement(const F& f);
+    // Interior elements have no distributed boundaries, halo elements have at least one
+    template <typename F>
+    void CallForEachInteriorElement(const F& f);
+    template <typename F>
+    void CallForEachHaloElement(const F& f);
     template <typename F>
     void CallForEachInterface(const F& f);
     template <typename F>
@@ -104,11 +122,36 @@ void Mesh<std::tuple<Elements...>,
           std::tuple<DistributedBoundaries...>>::CreateElement(const uint ID, Args&&... args) {
     using MasterType = typename ElementType::ElementMasterType;
 
-    MasterType& master_elt = std::get<Utilities::index<MasterType, MasterElementTypes>::value>(this->masters);
+    MasterType& master_elt = *std::get<Utilities::index<MasterType, MasterElementTypes>::value>(this->masters);
 
     this->elements.template emplace<ElementType>(ID, ElementType(ID, master_elt, std::forward<Args>(args)...));
 }
 
+template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
+template <typename ElementType, typename F>
+void Mesh<std::tuple<Elements...>,
+          std::tuple<Interfaces...>,
+          std::tuple<Boundaries...>,
+          std::tuple<DistributedBoundaries...>>::CreateElements(const std::vector<uint>& IDs, const F& make_element) {
+    using MasterType = typename ElementType::ElementMasterType;
+
+    MasterType& master_elt = *std::get<Utilities::index<MasterType, MasterElementTypes>::value>(this->masters);
+
+    const uint n_elements = IDs.size();
+
+    // element initialization dominates the mesh construction, the insertion into the element map is cheap
+    AlignedVector<ElementType> new_elements(n_elements);
+
+#pragma omp parallel for schedule(static)
+    for (uint i = 0; i < n_elements; ++i) {
+        new_elements[i] = make_element(IDs[i], master_elt);
+    }
+
+    for (uint i = 0; i < n_elements; ++i) {
+        this->elements.template emplace<ElementType>(IDs[i], std::move(new_elements[i]));
+    }
+}
+
 template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
 template <typename InterfaceType, typename... Args>
 void Mesh<std::tuple<Elements...>,
@@ -142,8 +185,38 @@ void Mesh<std::tuple<Elements...>,
           std::tuple<Interfaces...>,
           std::tuple<Boundaries...>,
           std::tuple<DistributedBoundaries...>>::CallForEachElement(const F& f) {
+    // scratch memory obtained while processing an element is reused for the next one
     Utilities::for_each_in_tuple(this->elements.data, [&f](auto& element_map) {
-        std::for_each(element_map.begin(), element_map.end(), [&f](auto& pair) { f(pair.second); });
+        std::for_each(element_map.begin(), element_map.end(), [&f](auto& pair) {
+            Utilities::ScratchArena::Scope scratch;
+            f(pair.second);
+        });
+    });
+}
+
+template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
+template <typename F>
+void Mesh<std::tuple<Elements...>,
+          std::tuple<Interfaces...>,
+          std::tuple<Boundaries...>,
+          std::tuple<DistributedBoundaries...>>::CallForEachInteriorElement(const F& f) {
+    this->CallForEachElement([&f](auto& elt) {
+        if (!elt.HasDistributedBoundary()) {
+            f(elt);
+        }
+    });
+}
+
+template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
+template <typename F>
+void Mesh<std::tuple<Elements...>,
+          std::tuple<Interfaces...>,
+          std::tuple<Boundaries...>,
+          std::tuple<DistributedBoundaries...>>::CallForEachHaloElement(const F& f) {
+    this->CallForEachElement([&f](auto& elt) {
+        if (elt.HasDistributedBoundary()) {
+            f(elt);
+        }
     });
 }
 
@@ -189,7 +262,10 @@ void Mesh<std::tuple<Elements...>,
     auto& el_container =
         std::get<Utilities::index<ElementType, typename ElementContainer::TupleType>::value>(this->elements.data);
 
-    std::for_each(el_container.begin(), el_container.end(), f);
+    std::for_each(el_container.begin(), el_container.end(), [&f](auto& elt) {
+        Utilities::ScratchArena::Scope scratch;
+        f(elt);
+    });
 }
 
 template <typename... Elements, typename... Interfaces, typename... Boundaries, typename... DistributedBoundaries>
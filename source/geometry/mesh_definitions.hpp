@@ -18,7 +18,11 @@
 namespace Geometry {
 template <typename Data>
 using ElementTypeTuple = std::tuple<
-    Element<2, Master::Triangle<Basis::Dubiner_2D, Integration::Dunavant_2D>, Shape::StraightTriangle, Data>>;
+    Element<2, Master::Triangle<Basis::Dubiner_2D, Integration::Dunavant_2D>, Shape::StraightTriangle, Data>,
+    Element<2,
+            Master::Quadrilateral<Basis::Legendre_2D, Integration::GaussLegendre_2D>,
+            Shape::StraightQuadrilateral,
+            Data>>;
 
 template <typename Data, typename... ISPs>
 using InterfaceTypeTuple = std::tuple<Interface<1, Integration::GaussLegendre_1D, Data, ISPs>...>;
@@ -18,12 +18,32 @@ struct make_master_type<std::tuple<E, Es...>> {
                                                 typename make_master_type<std::tuple<Es...>>::type>::type;
 };
 
+// Masters only depend on their type, i.e. basis and integration rule, and on p. Hence, they are built once per
+// process and shared by all meshes, e.g. all submeshes of a rank, and by meshes rebuilt after migration.
+template <typename MasterType>
+MasterType& get_master(const uint p) {
+    static std::mutex masters_mutex;
+    static std::map<uint, std::unique_ptr<MasterType>> masters;
+
+    std::lock_guard<std::mutex> lock(masters_mutex);
+
+    std::unique_ptr<MasterType>& master = masters[p];
+
+    if (!master) {
+        master = std::make_unique<MasterType>(p);
+    }
+
+    return *master;
+}
+
 template <typename... Ms>
 struct master_maker;
 
 template <typename... Ms>
 struct master_maker<std::tuple<Ms...>> {
-    static std::tuple<Ms...> construct_masters(uint p) { return std::make_tuple(Ms(p)...); };
+    using MasterPointerTypes = std::tuple<Ms*...>;
+
+    static MasterPointerTypes construct_masters(uint p) { return std::make_tuple(&get_master<Ms>(p)...); };
 };
 }
 
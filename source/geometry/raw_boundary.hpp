@@ -32,7 +32,145 @@ class RawBoundary {
           basis(basis),
           master(master),
           shape(shape) {}
+
+    template <typename IntegrationType>
+    const Master::TraceOperators<dimension + 1>& GetTraceOperators(const uint p_rule);
 };
+
+template <uint dimension, typename DataType>
+template <typename IntegrationType>
+const Master::TraceOperators<dimension + 1>& RawBoundary<dimension, DataType>::GetTraceOperators(const uint p_rule) {
+    std::pair<uint, uint> key{this->bound_id, p_rule};
+
+    // masters are shared between meshes, which may be built concurrently
+    std::lock_guard<std::mutex> lock(this->master.trace_operators_mutex);
+
+    auto trace_it = this->master.trace_operators.find(key);
+
+    if (trace_it != this->master.trace_operators.end()) {
+        return trace_it->second;
+    }
+
+    IntegrationType integration;
+
+    std::pair<DynVector<double>, AlignedVector<Point<dimension>>> integration_rule = integration.GetRule(p_rule);
+
+    uint ngp  = integration_rule.first.size();
+    uint ndof = this->master.ndof;
+
+    AlignedVector<Point<dimension + 1>> z_master =
+        this->master.BoundaryToMasterCoordinates(this->bound_id, integration_rule.second);
+
+    Master::TraceOperators<dimension + 1> trace;
+
+    // nodal and modal bases are defined on the master element, hence the same for all shapes of this master
+    trace.psi_gp       = this->shape.GetPsi(z_master);
+    trace.psi_bound_gp = this->shape.GetBoundaryPsi(this->bound_id, integration_rule.second);
+    trace.phi_gp       = this->basis.GetPhi(this->p, z_master);
+
+    trace.int_fact = integration_rule.first;
+
+    trace.int_phi_fact = transpose(trace.phi_gp);
+    for (uint dof = 0; dof < ndof; ++dof) {
+        for (uint gp = 0; gp < ngp; ++gp) {
+            trace.int_phi_fact(gp, dof) *= integration_rule.first[gp];
+        }
+    }
+
+    return this->master.trace_operators.emplace(key, std::move(trace)).first->second;
+}
+
+// Raw boundaries of one boundary type in a flat array. Keys are {element ID, neighbor ID} for internal and
+// {element ID, bound ID} for external boundaries. After Sort() entries are in key order, which is the order
+// meshes create interfaces and boundaries in, and look-ups are binary searches. Erased entries are only marked.
+template <uint dimension, typename DataType>
+class RawBoundaryTable {
+  public:
+    using KeyType   = std::pair<uint, uint>;
+    using EntryType = std::pair<KeyType, RawBoundary<dimension, DataType>>;
+    using iterator  = typename std::vector<EntryType>::iterator;
+
+  private:
+    std::vector<EntryType> entries;
+    std::vector<bool> erased;
+
+    uint n_erased = 0;
+
+  public:
+    uint size() const { return this->entries.size() - this->n_erased; }
+
+    iterator begin() { return this->entries.begin(); }
+    iterator end() { return this->entries.end(); }
+
+    void emplace(const KeyType& key, RawBoundary<dimension, DataType>&& raw_boundary) {
+        this->entries.emplace_back(key, std::move(raw_boundary));
+        this->erased.push_back(false);
+    }
+
+    void Sort();
+
+    iterator find(const KeyType& key);
+    void erase(const KeyType& key);
+    void clear();
+};
+
+template <uint dimension, typename DataType>
+void RawBoundaryTable<dimension, DataType>::Sort() {
+    std::vector<uint> order(this->entries.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::sort(order.begin(), order.end(), [this](const uint i, const uint j) {
+        return this->entries[i].first < this->entries[j].first;
+    });
+
+    // raw boundaries hold references, hence they are moved into place rather than swapped
+    std::vector<EntryType> sorted_entries;
+    std::vector<bool> sorted_erased;
+
+    sorted_entries.reserve(this->entries.size());
+    sorted_erased.reserve(this->entries.size());
+
+    for (uint i : order) {
+        sorted_entries.emplace_back(std::move(this->entries[i]));
+        sorted_erased.push_back(this->erased[i]);
+    }
+
+    this->entries = std::move(sorted_entries);
+    this->erased  = std::move(sorted_erased);
+}
+
+template <uint dimension, typename DataType>
+typename RawBoundaryTable<dimension, DataType>::iterator RawBoundaryTable<dimension, DataType>::find(
+    const KeyType& key) {
+    auto it = std::lower_bound(this->entries.begin(),
+                               this->entries.end(),
+                               key,
+                               [](const EntryType& entry, const KeyType& key) { return entry.first < key; });
+
+    if (it == this->entries.end() || it->first != key || this->erased[it - this->entries.begin()]) {
+        return this->entries.end();
+    }
+
+    return it;
+}
+
+template <uint dimension, typename DataType>
+void RawBoundaryTable<dimension, DataType>::erase(const KeyType& key) {
+    auto it = this->find(key);
+
+    if (it != this->entries.end()) {
+        this->erased[it - this->entries.begin()] = true;
+        ++this->n_erased;
+    }
+}
+
+template <uint dimension, typename DataType>
+void RawBoundaryTable<dimension, DataType>::clear() {
+    this->entries.clear();
+    this->erased.clear();
+
+    this->n_erased = 0;
+}
 }
 
 #endif
\ No newline at end of file
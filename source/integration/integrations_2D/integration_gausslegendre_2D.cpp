@@ -0,0 +1,32 @@
+#include "../integrations_2D.hpp"
+
+namespace Integration {
+std::pair<DynVector<double>, AlignedVector<Point<2>>> GaussLegendre_2D::GetRule(const uint p) {
+    std::pair<DynVector<double>, AlignedVector<Point<1>>> rule_1D = this->integration_1D.GetRule(p);
+
+    uint ngp_1D = rule_1D.first.size();
+
+    std::pair<DynVector<double>, AlignedVector<Point<2>>> rule;
+    rule.first.resize(ngp_1D * ngp_1D);
+    rule.second.resize(ngp_1D * ngp_1D);
+
+    for (uint a = 0; a < ngp_1D; ++a) {
+        for (uint b = 0; b < ngp_1D; ++b) {
+            uint gp = a * ngp_1D + b;
+
+            rule.first[gp] = rule_1D.first[a] * rule_1D.first[b];
+
+            rule.second[gp][LocalCoordQuad::n1] = rule_1D.second[a][LocalCoordLin::l1];
+            rule.second[gp][LocalCoordQuad::n2] = rule_1D.second[b][LocalCoordLin::l1];
+        }
+    }
+
+    return rule;
+}
+
+uint GaussLegendre_2D::GetNumGP(const uint p) {
+    uint ngp_1D = this->integration_1D.GetNumGP(p);
+
+    return ngp_1D * ngp_1D;
+}
+}
@@ -0,0 +1,328 @@
+#include "../master_elements_2D.hpp"
+
+namespace Master {
+template <typename BasisType, typename IntegrationType>
+Quadrilateral<BasisType, IntegrationType>::Quadrilateral(const uint p) : Master<2>(p) {
+    this->nvrtx  = 4;
+    this->nbound = 4;
+
+    this->integration_rule = this->integration.GetRule(2 * this->p);
+
+    this->ndof = (p + 1) * (p + 1);
+    this->ngp  = this->integration_rule.first.size();
+
+    this->T_basis_linear = this->basis.GetBasisLinearT(p);
+    this->T_linear_basis = this->basis.GetLinearBasisT(p);
+
+    this->chi_baryctr.resize(this->nvrtx);
+
+    for (uint vrtx = 0; vrtx < this->nvrtx; ++vrtx) {
+        this->chi_baryctr[vrtx] = 1.0 / 4.0;
+    }
+
+    this->chi_midpts.resize(this->nvrtx, this->nbound);
+
+    set_constant(this->chi_midpts, 0.0);
+
+    for (uint bound = 0; bound < this->nbound; ++bound) {
+        this->chi_midpts(bound, bound)           = 1.0 / 2.0;
+        this->chi_midpts((bound + 1) % 4, bound) = 1.0 / 2.0;
+    }
+
+    this->chi_gp.resize(this->nvrtx, this->ngp);
+    this->dchi_gp[LocalCoordQuad::n1].resize(this->nvrtx, this->ngp);
+    this->dchi_gp[LocalCoordQuad::n2].resize(this->nvrtx, this->ngp);
+
+    for (uint gp = 0; gp < this->ngp; ++gp) {
+        double n1 = this->integration_rule.second[gp][LocalCoordQuad::n1];
+        double n2 = this->integration_rule.second[gp][LocalCoordQuad::n2];
+
+        this->chi_gp(0, gp) = (1 - n1) * (1 - n2) / 4.0;
+        this->chi_gp(1, gp) = (1 + n1) * (1 - n2) / 4.0;
+        this->chi_gp(2, gp) = (1 + n1) * (1 + n2) / 4.0;
+        this->chi_gp(3, gp) = (1 - n1) * (1 + n2) / 4.0;
+
+        this->dchi_gp[LocalCoordQuad::n1](0, gp) = -(1 - n2) / 4.0;
+        this->dchi_gp[LocalCoordQuad::n2](0, gp) = -(1 - n1) / 4.0;
+
+        this->dchi_gp[LocalCoordQuad::n1](1, gp) = (1 - n2) / 4.0;
+        this->dchi_gp[LocalCoordQuad::n2](1, gp) = -(1 + n1) / 4.0;
+
+        this->dchi_gp[LocalCoordQuad::n1](2, gp) = (1 + n2) / 4.0;
+        this->dchi_gp[LocalCoordQuad::n2](2, gp) = (1 + n1) / 4.0;
+
+        this->dchi_gp[LocalCoordQuad::n1](3, gp) = -(1 + n2) / 4.0;
+        this->dchi_gp[LocalCoordQuad::n2](3, gp) = (1 - n1) / 4.0;
+    }
+
+    this->phi_gp  = this->basis.GetPhi(this->p, this->integration_rule.second);
+    this->dphi_gp = this->basis.GetDPhi(this->p, this->integration_rule.second);
+
+    AlignedVector<Point<2>> z_postprocessor_cell = this->VTKPostCell();
+    this->phi_postprocessor_cell                 = this->basis.GetPhi(this->p, z_postprocessor_cell);
+
+    AlignedVector<Point<2>> z_postprocessor_point = this->VTKPostPoint();
+    this->phi_postprocessor_point                 = this->basis.GetPhi(this->p, z_postprocessor_point);
+
+    this->int_phi_fact = transpose(this->phi_gp);
+    for (uint dof = 0; dof < this->ndof; ++dof) {
+        for (uint gp = 0; gp < this->ngp; ++gp) {
+            this->int_phi_fact(gp, dof) *= this->integration_rule.first[gp];
+        }
+    }
+
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->int_dphi_fact[dir] = transpose(this->dphi_gp[dir]);
+        for (uint dof = 0; dof < this->ndof; ++dof) {
+            for (uint gp = 0; gp < this->ngp; ++gp) {
+                this->int_dphi_fact[dir](gp, dof) *= this->integration_rule.first[gp];
+            }
+        }
+    }
+
+#ifdef LEAN_AFFINE_ELEMENTS
+    this->int_phi_phi_fact.resize(this->ngp, this->ndof * this->ndof);
+    for (uint dof_i = 0; dof_i < this->ndof; ++dof_i) {
+        for (uint dof_j = 0; dof_j < this->ndof; ++dof_j) {
+            uint lookup = this->ndof * dof_i + dof_j;
+            for (uint gp = 0; gp < this->ngp; ++gp) {
+                this->int_phi_phi_fact(gp, lookup) = this->phi_gp(dof_i, gp) * this->int_phi_fact(gp, dof_j);
+            }
+        }
+    }
+
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->int_phi_dphi_fact[dir].resize(this->ngp, this->ndof * this->ndof);
+        for (uint dof_i = 0; dof_i < this->ndof; ++dof_i) {
+            for (uint dof_j = 0; dof_j < this->ndof; ++dof_j) {
+                uint lookup = this->ndof * dof_i + dof_j;
+                for (uint gp = 0; gp < this->ngp; ++gp) {
+                    this->int_phi_dphi_fact[dir](gp, lookup) =
+                        this->phi_gp(dof_i, gp) * this->int_dphi_fact[dir](gp, dof_j);
+                }
+            }
+        }
+    }
+#endif
+
+#ifdef QUADRATURE_FREE_FLUX
+    this->phi_nodal = this->basis.GetPhi(this->p, this->NodalPoints());
+
+    // modal coefficients of the interpolant are phi_nodal^-1 * u_nodal, whose integrals against dphi are exact
+    DynMatrix<double> nodal_to_modal = inverse(this->phi_nodal);
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->int_nodal_dphi_fact[dir] = nodal_to_modal * this->phi_gp * this->int_dphi_fact[dir];
+    }
+#endif
+
+    this->m_inv = Basis::get_minv(this->basis, this->p);
+
+    // 1D FACTORS FOR SUM FACTORIZATION
+    typename BasisType::Basis1D basis_1D;
+    typename IntegrationType::Integration1D integration_1D;
+
+    std::pair<DynVector<double>, AlignedVector<Point<1>>> rule_1D = integration_1D.GetRule(2 * this->p);
+
+    this->ndof_1D = p + 1;
+    this->ngp_1D  = rule_1D.first.size();
+
+    this->phi_1D              = basis_1D.GetPhi(this->p, rule_1D.second);
+    DynMatrix<double> dphi_1D = basis_1D.GetDPhi(this->p, rule_1D.second)[LocalCoordLin::l1];
+
+    this->int_phi_1D  = transpose(this->phi_1D);
+    this->int_dphi_1D = transpose(dphi_1D);
+    for (uint dof = 0; dof < this->ndof_1D; ++dof) {
+        for (uint gp = 0; gp < this->ngp_1D; ++gp) {
+            this->int_phi_1D(gp, dof) *= rule_1D.first[gp];
+            this->int_dphi_1D(gp, dof) *= rule_1D.first[gp];
+        }
+    }
+}
+
+template <typename BasisType, typename IntegrationType>
+AlignedVector<Point<2>> Quadrilateral<BasisType, IntegrationType>::BoundaryToMasterCoordinates(
+    const uint bound_id,
+    const AlignedVector<Point<1>>& z_boundary) const {
+    // *** //
+    uint ngp = z_boundary.size();
+
+    AlignedVector<Point<2>> z_master(ngp);
+
+    for (uint gp = 0; gp < ngp; ++gp) {
+        assert(std::abs(z_boundary[gp][LocalCoordLin::l1]) < 1 + 100 * std::numeric_limits<double>::epsilon());
+
+        double z = z_boundary[gp][LocalCoordLin::l1];
+
+        if (bound_id == 0) {
+            z_master[gp][LocalCoordQuad::n1] = z;
+            z_master[gp][LocalCoordQuad::n2] = -1.0;
+        } else if (bound_id == 1) {
+            z_master[gp][LocalCoordQuad::n1] = 1.0;
+            z_master[gp][LocalCoordQuad::n2] = z;
+        } else if (bound_id == 2) {
+            z_master[gp][LocalCoordQuad::n1] = -z;
+            z_master[gp][LocalCoordQuad::n2] = 1.0;
+        } else if (bound_id == 3) {
+            z_master[gp][LocalCoordQuad::n1] = -1.0;
+            z_master[gp][LocalCoordQuad::n2] = -z;
+        }
+    }
+
+    return z_master;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+DynMatrixMap<double> Quadrilateral<BasisType, IntegrationType>::ComputeUgp(const InputArrayType& u) const {
+    const uint nvar = rows(u);
+    const uint nd   = this->ndof_1D;
+    const uint nq   = this->ngp_1D;
+
+    auto& arena = Utilities::ScratchArena::Local();
+
+    DynMatrixMap<double> u_gp = matrix_from_array(arena.Allocate<double>(nvar * nq * nq), nvar, nq * nq);
+
+    // the intermediate contraction is released on return, u_gp lives on in the caller's scope
+    Utilities::ScratchArena::Scope scope;
+
+    // contract n2 dofs: u_n2(q, i * nq + b) = u(q, i * nd + j) * phi_1D(j, b)
+    DynMatrixMap<double> u_n2 = matrix_from_array(arena.Allocate<double>(nvar * nd * nq), nvar, nd * nq);
+    for (uint i = 0; i < nd; ++i) {
+        noalias(submatrix(u_n2, 0, i * nq, nvar, nq)) = submatrix(u, 0, i * nd, nvar, nd) * this->phi_1D;
+    }
+
+    // contract n1 dofs: u_gp(q, a * nq + b) = u_n2(q, i * nq + b) * phi_1D(i, a)
+    set_constant(u_gp, 0.0);
+    for (uint a = 0; a < nq; ++a) {
+        for (uint i = 0; i < nd; ++i) {
+            submatrix(u_gp, 0, a * nq, nvar, nq) += this->phi_1D(i, a) * submatrix(u_n2, 0, i * nq, nvar, nq);
+        }
+    }
+
+    return u_gp;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+DynMatrixMap<double> Quadrilateral<BasisType, IntegrationType>::IntegrationDPhi(const uint z,
+                                                                                 const InputArrayType& u_gp) const {
+    const uint nvar = rows(u_gp);
+    const uint nd   = this->ndof_1D;
+    const uint nq   = this->ngp_1D;
+
+    // d/dn1 falls onto the n1 factor of the basis, d/dn2 onto the n2 factor
+    const DynMatrix<double>& int_n1 = (z == LocalCoordQuad::n1) ? this->int_dphi_1D : this->int_phi_1D;
+    const DynMatrix<double>& int_n2 = (z == LocalCoordQuad::n2) ? this->int_dphi_1D : this->int_phi_1D;
+
+    auto& arena = Utilities::ScratchArena::Local();
+
+    DynMatrixMap<double> integral = matrix_from_array(arena.Allocate<double>(nvar * nd * nd), nvar, nd * nd);
+
+    Utilities::ScratchArena::Scope scope;
+
+    // contract n2 gps: u_n2(q, a * nd + j) = u_gp(q, a * nq + b) * int_n2(b, j)
+    DynMatrixMap<double> u_n2 = matrix_from_array(arena.Allocate<double>(nvar * nq * nd), nvar, nq * nd);
+    for (uint a = 0; a < nq; ++a) {
+        noalias(submatrix(u_n2, 0, a * nd, nvar, nd)) = submatrix(u_gp, 0, a * nq, nvar, nq) * int_n2;
+    }
+
+    // contract n1 gps: integral(q, i * nd + j) = u_n2(q, a * nd + j) * int_n1(a, i)
+    set_constant(integral, 0.0);
+    for (uint i = 0; i < nd; ++i) {
+        for (uint a = 0; a < nq; ++a) {
+            submatrix(integral, 0, i * nd, nvar, nd) += int_n1(a, i) * submatrix(u_n2, 0, a * nd, nvar, nd);
+        }
+    }
+
+    return integral;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+decltype(auto) Quadrilateral<BasisType, IntegrationType>::ProjectBasisToLinear(const InputArrayType& u) const {
+    return u * this->T_basis_linear;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+decltype(auto) Quadrilateral<BasisType, IntegrationType>::ProjectLinearToBasis(const InputArrayType& u_lin) const {
+    return u_lin * this->T_linear_basis;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+inline decltype(auto) Quadrilateral<BasisType, IntegrationType>::ComputeLinearUbaryctr(
+    const InputArrayType& u_lin) const {
+    return u_lin * this->chi_baryctr;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+inline decltype(auto) Quadrilateral<BasisType, IntegrationType>::ComputeLinearUmidpts(
+    const InputArrayType& u_lin) const {
+    return u_lin * this->chi_midpts;
+}
+
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+inline decltype(auto) Quadrilateral<BasisType, IntegrationType>::ComputeLinearUvrtx(const InputArrayType& u_lin) const {
+    return u_lin;
+}
+
+template <typename BasisType, typename IntegrationType>
+AlignedVector<Point<2>> Quadrilateral<BasisType, IntegrationType>::VTKPostCell() const {
+    AlignedVector<Point<2>> z_postprocessor_cell(N_DIV * N_DIV);
+
+    double dz = 2.0 / N_DIV;
+
+    uint n_pt = 0;
+    for (uint i = 0; i < N_DIV; ++i) {
+        for (uint j = 0; j < N_DIV; ++j) {
+            z_postprocessor_cell[n_pt][LocalCoordQuad::n1] = -1.0 + dz * j + dz / 2.0;  // CENTROID
+            z_postprocessor_cell[n_pt][LocalCoordQuad::n2] = -1.0 + dz * i + dz / 2.0;
+            n_pt++;
+        }
+    }
+
+    return z_postprocessor_cell;
+}
+
+template <typename BasisType, typename IntegrationType>
+AlignedVector<Point<2>> Quadrilateral<BasisType, IntegrationType>::VTKPostPoint() const {
+    AlignedVector<Point<2>> z_postprocessor_point((N_DIV + 1) * (N_DIV + 1));
+
+    double dz = 2.0 / N_DIV;
+
+    uint n_pt = 0;
+    for (uint i = 0; i <= N_DIV; ++i) {
+        for (uint j = 0; j <= N_DIV; ++j) {
+            z_postprocessor_point[n_pt][LocalCoordQuad::n1] = -1.0 + dz * j;
+            z_postprocessor_point[n_pt][LocalCoordQuad::n2] = -1.0 + dz * i;
+            n_pt++;
+        }
+    }
+
+    return z_postprocessor_point;
+}
+
+#ifdef QUADRATURE_FREE_FLUX
+template <typename BasisType, typename IntegrationType>
+AlignedVector<Point<2>> Quadrilateral<BasisType, IntegrationType>::NodalPoints() const {
+    // tensor product of the Gauss-Lobatto points
+    std::vector<double> n_gl = this->p == 0 ? std::vector<double>{0.0} : Basis::gauss_lobatto_points(this->p);
+
+    AlignedVector<Point<2>> z_nodal((this->p + 1) * (this->p + 1));
+
+    uint n_pt = 0;
+    for (uint i = 0; i <= this->p; ++i) {
+        for (uint j = 0; j <= this->p; ++j) {
+            z_nodal[n_pt][LocalCoordQuad::n1] = n_gl[j];
+            z_nodal[n_pt][LocalCoordQuad::n2] = n_gl[i];
+            n_pt++;
+        }
+    }
+
+    return z_nodal;
+}
+#endif
+}
\ No newline at end of file
@@ -78,7 +78,42 @@ Triangle<BasisType, IntegrationType>::Triangle(const uint p) : Master<2>(p) {
         }
     }
 
-    this->m_inv = this->basis.GetMinv(this->p);
+#ifdef LEAN_AFFINE_ELEMENTS
+    this->int_phi_phi_fact.resize(this->ngp, this->ndof * this->ndof);
+    for (uint dof_i = 0; dof_i < this->ndof; ++dof_i) {
+        for (uint dof_j = 0; dof_j < this->ndof; ++dof_j) {
+            uint lookup = this->ndof * dof_i + dof_j;
+            for (uint gp = 0; gp < this->ngp; ++gp) {
+                this->int_phi_phi_fact(gp, lookup) = this->phi_gp(dof_i, gp) * this->int_phi_fact(gp, dof_j);
+            }
+        }
+    }
+
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->int_phi_dphi_fact[dir].resize(this->ngp, this->ndof * this->ndof);
+        for (uint dof_i = 0; dof_i < this->ndof; ++dof_i) {
+            for (uint dof_j = 0; dof_j < this->ndof; ++dof_j) {
+                uint lookup = this->ndof * dof_i + dof_j;
+                for (uint gp = 0; gp < this->ngp; ++gp) {
+                    this->int_phi_dphi_fact[dir](gp, lookup) =
+                        this->phi_gp(dof_i, gp) * this->int_dphi_fact[dir](gp, dof_j);
+                }
+            }
+        }
+    }
+#endif
+
+#ifdef QUADRATURE_FREE_FLUX
+    this->phi_nodal = this->basis.GetPhi(this->p, this->NodalPoints());
+
+    // modal coefficients of the interpolant are phi_nodal^-1 * u_nodal, whose integrals against dphi are exact
+    DynMatrix<double> nodal_to_modal = inverse(this->phi_nodal);
+    for (uint dir = 0; dir < 2; ++dir) {
+        this->int_nodal_dphi_fact[dir] = nodal_to_modal * this->phi_gp * this->int_dphi_fact[dir];
+    }
+#endif
+
+    this->m_inv = Basis::get_minv(this->basis, this->p);
 }
 
 template <typename BasisType, typename IntegrationType>
@@ -116,6 +151,13 @@ AlignedVector<Point<2>> Triangle<BasisType, IntegrationType>::BoundaryToMasterCo
     return z_master;
 }
 
+template <typename BasisType, typename IntegrationType>
+template <typename InputArrayType>
+inline decltype(auto) Triangle<BasisType, IntegrationType>::ComputeUgp(const InputArrayType& u) const {
+    // u_gp(q, gp) = u(q, dof) * phi_gp(dof, gp)
+    return u * this->phi_gp;
+}
+
 template <typename BasisType, typename IntegrationType>
 template <typename InputArrayType>
 decltype(auto) Triangle<BasisType, IntegrationType>::ProjectBasisToLinear(const InputArrayType& u) const {
@@ -188,4 +230,77 @@ AlignedVector<Point<2>> Triangle<BasisType, IntegrationType>::VTKPostPoint() con
 
     return z_postprocessor_point;
 }
+
+#ifdef QUADRATURE_FREE_FLUX
+template <typename BasisType, typename IntegrationType>
+AlignedVector<Point<2>> Triangle<BasisType, IntegrationType>::NodalPoints() const {
+    // Warp & Blend points (Warburton 2006) with the blending parameters optimized for the Lebesgue constant
+    const std::array<double, 16> alpha_opt{0.0,    0.0,    0.0,    1.4152, 0.1001, 0.2751, 0.9800, 1.0999,
+                                           1.2832, 1.3648, 1.4773, 1.4959, 1.5743, 1.5770, 1.6223, 1.6258};
+
+    if (this->p == 0) {
+        return AlignedVector<Point<2>>{{-1.0 / 3.0, -1.0 / 3.0}};
+    }
+
+    const double alpha = this->p < 16 ? alpha_opt[this->p] : 5.0 / 3.0;
+
+    std::vector<double> r_gl = Basis::gauss_lobatto_points(this->p);
+
+    // displacement of the equidistant points towards the Gauss-Lobatto points along an edge, scaled by 1 / (1 - r^2)
+    auto warp_factor = [this, &r_gl](const double r) {
+        double warp = 0.0;
+
+        for (uint i = 0; i <= this->p; ++i) {
+            double r_eq_i = -1.0 + 2.0 * i / this->p;
+
+            double lagrange = 1.0;
+            for (uint j = 0; j <= this->p; ++j) {
+                if (j != i) {
+                    double r_eq_j = -1.0 + 2.0 * j / this->p;
+
+                    lagrange *= (r - r_eq_j) / (r_eq_i - r_eq_j);
+                }
+            }
+
+            warp += lagrange * (r_gl[i] - r_eq_i);
+        }
+
+        return std::abs(r) < 1.0 - 1.0e-10 ? warp / (1.0 - r * r) : 0.0;
+    };
+
+    AlignedVector<Point<2>> z_nodal((this->p + 1) * (this->p + 2) / 2);
+
+    uint n_pt = 0;
+    for (uint i = 0; i <= this->p; ++i) {
+        for (uint j = 0; j <= this->p - i; ++j) {
+            // barycentric coordinates of the equidistant points
+            double L1 = (double)i / this->p;
+            double L3 = (double)j / this->p;
+            double L2 = 1.0 - L1 - L3;
+
+            // warp and blend on the equilateral triangle
+            double x = -L2 + L3;
+            double y = (-L2 - L3 + 2.0 * L1) / std::sqrt(3.0);
+
+            double warp1 = 4.0 * L2 * L3 * warp_factor(L3 - L2) * (1.0 + std::pow(alpha * L1, 2));
+            double warp2 = 4.0 * L1 * L3 * warp_factor(L1 - L3) * (1.0 + std::pow(alpha * L2, 2));
+            double warp3 = 4.0 * L1 * L2 * warp_factor(L2 - L1) * (1.0 + std::pow(alpha * L3, 2));
+
+            x += warp1 + std::cos(2.0 * PI / 3.0) * warp2 + std::cos(4.0 * PI / 3.0) * warp3;
+            y += std::sin(2.0 * PI / 3.0) * warp2 + std::sin(4.0 * PI / 3.0) * warp3;
+
+            // map back onto the master triangle
+            L1 = (std::sqrt(3.0) * y + 1.0) / 3.0;
+            L2 = (-3.0 * x - std::sqrt(3.0) * y + 2.0) / 6.0;
+            L3 = (3.0 * x - std::sqrt(3.0) * y + 2.0) / 6.0;
+
+            z_nodal[n_pt][LocalCoordTri::z1] = -L2 + L3 - L1;
+            z_nodal[n_pt][LocalCoordTri::z2] = -L2 - L3 + L1;
+            n_pt++;
+        }
+    }
+
+    return z_nodal;
+}
+#endif
 }
\ No newline at end of file
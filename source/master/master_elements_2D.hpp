@@ -2,6 +2,8 @@
 #define CLASS_MASTER_ELEMENT_HPP
 
 #include "general_definitions.hpp"
+#include "basis/basis_polynomials.hpp"
+#include "utilities/scratch_arena.hpp"
 
 namespace Master {
 /**
@@ -12,6 +14,10 @@ namespace Master {
 template <typename BasisType, typename IntegrationType>
 class Triangle : public Master<2> {
   public:
+    using MinvType = Basis::MinvType<BasisType>;
+
+    static constexpr bool is_tensor_product = false;
+
     /**
      * The basis used over the element.
      */
@@ -22,6 +28,11 @@ class Triangle : public Master<2> {
      */
     IntegrationType integration;
 
+    /**
+     * Inverted mass matrix over the master triangle.
+     */
+    MinvType m_inv;
+
   public:
     /**
      * Default constructor
@@ -53,6 +64,9 @@ class Triangle : public Master<2> {
     AlignedVector<Point<2>> BoundaryToMasterCoordinates(const uint bound_id,
                                                         const AlignedVector<Point<1>>& z_boundary) const override;
 
+    template <typename InputArrayType>
+    decltype(auto) ComputeUgp(const InputArrayType& u) const;
+
     template <typename InputArrayType>
     decltype(auto) ProjectBasisToLinear(const InputArrayType& u) const;
     template <typename InputArrayType>
@@ -68,9 +82,120 @@ class Triangle : public Master<2> {
   private:
     AlignedVector<Point<2>> VTKPostCell() const override;
     AlignedVector<Point<2>> VTKPostPoint() const override;
+
+#ifdef QUADRATURE_FREE_FLUX
+    AlignedVector<Point<2>> NodalPoints() const;
+#endif
+};
+
+/**
+ * Quadrilateral master element.
+ * Quadrilateral master elements contain the information necessary for evaluating computations on
+ * the master quadrilateral. Since both the basis and the integration rule are tensor products of
+ * their 1D counterparts, evaluations at Gauss points and integrations against derivatives of the
+ * basis are sum-factorized, i.e. applied one direction at a time.
+ */
+template <typename BasisType, typename IntegrationType>
+class Quadrilateral : public Master<2> {
+  public:
+    using MinvType = Basis::MinvType<BasisType>;
+
+    static constexpr bool is_tensor_product = true;
+
+    /**
+     * The basis used over the element.
+     */
+    BasisType basis;
+
+    /**
+     * Integration rule used for evaluating integrals over the element.
+     */
+    IntegrationType integration;
+
+    /**
+     * Inverted mass matrix over the master quadrilateral.
+     */
+    MinvType m_inv;
+
+    uint ndof_1D;
+    uint ngp_1D;
+
+    DynMatrix<double> phi_1D;       // phi_1D(dof_1D, gp_1D)
+    DynMatrix<double> int_phi_1D;   // int_phi_1D(gp_1D, dof_1D) = w_gp * phi_1D(dof_1D, gp_1D)
+    DynMatrix<double> int_dphi_1D;  // int_dphi_1D(gp_1D, dof_1D) = w_gp * dphi_1D(dof_1D, gp_1D)
+
+  public:
+    /**
+     * Default constructor
+     */
+    Quadrilateral() = default;
+
+    /**
+     * Construct a master quadrilateral with polynomial order p.
+     *
+     * @param p Polynomial order
+     */
+    Quadrilateral(const uint p);
+
+    /**
+     * Transform coordinates on a boundary to master element coordinates.
+     * Boundary k runs from vertex k to vertex k + 1 of the master quadrilateral, i.e.
+     *
+     * Boundary ID | -1 Mapped To: | 1 Mapped To:
+     * ------------|---------------|-------------
+     *      0      |   (-1,-1)     |   ( 1,-1)
+     *      1      |   ( 1,-1)     |   ( 1, 1)
+     *      2      |   ( 1, 1)     |   (-1, 1)
+     *      3      |   (-1, 1)     |   (-1,-1)
+     *
+     * @param bound_id The ID of the boundary
+     * @param The points on the boundary
+     */
+    AlignedVector<Point<2>> BoundaryToMasterCoordinates(const uint bound_id,
+                                                        const AlignedVector<Point<1>>& z_boundary) const override;
+
+    /**
+     * Evaluate u at the Gauss points, sum-factorized.
+     *
+     * @param u modal coefficients u(var, dof)
+     * @return u_gp(var, gp), held by the scratch arena of the calling thread
+     */
+    template <typename InputArrayType>
+    DynMatrixMap<double> ComputeUgp(const InputArrayType& u) const;
+
+    /**
+     * Integrate u_gp against the derivatives of the basis in the master direction z, sum-factorized.
+     *
+     * @param z master coordinate direction
+     * @param u_gp values at the Gauss points u_gp(var, gp)
+     * @return integral(var, dof), held by the scratch arena of the calling thread
+     */
+    template <typename InputArrayType>
+    DynMatrixMap<double> IntegrationDPhi(const uint z, const InputArrayType& u_gp) const;
+
+    template <typename InputArrayType>
+    decltype(auto) ProjectBasisToLinear(const InputArrayType& u) const;
+    template <typename InputArrayType>
+    decltype(auto) ProjectLinearToBasis(const InputArrayType& u_lin) const;
+
+    template <typename InputArrayType>
+    decltype(auto) ComputeLinearUbaryctr(const InputArrayType& u_lin) const;
+    template <typename InputArrayType>
+    decltype(auto) ComputeLinearUmidpts(const InputArrayType& u_lin) const;
+    template <typename InputArrayType>
+    decltype(auto) ComputeLinearUvrtx(const InputArrayType& u_lin) const;
+
+  private:
+    AlignedVector<Point<2>> VTKPostCell() const override;
+    AlignedVector<Point<2>> VTKPostPoint() const override;
+
+#ifdef QUADRATURE_FREE_FLUX
+    AlignedVector<Point<2>> NodalPoints() const;
+#endif
 };
 }
 
 #include "elements_2D/master_triangle.tpp"
+#include "elements_2D/master_quadrilateral.tpp"
 
 #endif
@@ -27,29 +27,59 @@ void initialize_mesh(typename ProblemType::ProblemMeshType& mesh,
     initialize_mesh_interfaces_boundaries<ProblemType, Communicator>(mesh, input.problem_input, communicator, writer);
 }
 
+template <typename ElementType, typename MeshType>
+void create_elements(MeshType& mesh, MeshMetaData& mesh_data, const std::vector<uint>& elt_IDs) {
+    // elements are made concurrently, each one only moves its own entries out of the mesh meta data
+    mesh.template CreateElements<ElementType>(
+        elt_IDs, [&mesh_data](const uint elt_id, typename ElementType::ElementMasterType& master) {
+            ElementMetaData& element_meta = mesh_data.elements.at(elt_id);
+
+            return ElementType(elt_id,
+                               master,
+                               mesh_data.get_nodal_coordinates(elt_id),
+                               std::move(element_meta.node_ID),
+                               std::move(element_meta.neighbor_ID),
+                               std::move(element_meta.boundary_type));
+        });
+}
+
 template <typename ProblemType>
 void initialize_mesh_elements(typename ProblemType::ProblemMeshType& mesh,
                               InputParameters<typename ProblemType::ProblemInputType>& input,
                               typename ProblemType::ProblemWriterType& writer) {
     MeshMetaData& mesh_data = input.mesh_input.mesh_data;
 
-    using ElementType =
+    using ElementTypeTriangle =
         typename std::tuple_element<0, Geometry::ElementTypeTuple<typename ProblemType::ProblemDataType>>::type;
+    using ElementTypeQuadrilateral =
+        typename std::tuple_element<1, Geometry::ElementTypeTuple<typename ProblemType::ProblemDataType>>::type;
+
+    auto t_start = std::chrono::steady_clock::now();
+
+    std::vector<uint> triangle_IDs;
+    std::vector<uint> quadrilateral_IDs;
 
     for (auto& element_meta : mesh_data.elements) {
         uint elt_id = element_meta.first;
 
-        auto nodal_coordinates = mesh_data.get_nodal_coordinates(elt_id);
-
-        mesh.template CreateElement<ElementType>(elt_id,
-                                                 std::move(nodal_coordinates),
-                                                 std::move(element_meta.second.node_ID),
-                                                 std::move(element_meta.second.neighbor_ID),
-                                                 std::move(element_meta.second.boundary_type));
+        if (element_meta.second.node_ID.size() == 3) {
+            triangle_IDs.push_back(elt_id);
+        } else if (element_meta.second.node_ID.size() == 4) {
+            quadrilateral_IDs.push_back(elt_id);
+        } else {
+            throw std::logic_error("Fatal Error: element " + std::to_string(elt_id) + " has an unsupported number of " +
+                                   std::to_string(element_meta.second.node_ID.size()) + " nodes!\n");
+        }
     }
 
+    create_elements<ElementTypeTriangle>(mesh, mesh_data, triangle_IDs);
+    create_elements<ElementTypeQuadrilateral>(mesh, mesh_data, quadrilateral_IDs);
+
     if (writer.WritingLog()) {
-        writer.GetLogFile() << "Number of elements: " << mesh.GetNumberElements() << std::endl;
+        writer.GetLogFile() << "Number of elements: " << mesh.GetNumberElements() << std::endl
+                            << "Time to initialize elements: "
+                            << std::chrono::duration<double>(std::chrono::steady_clock::now() - t_start).count()
+                            << " s" << std::endl;
     }
 }
 
@@ -58,22 +88,55 @@ void initialize_mesh_interfaces_boundaries(typename ProblemType::ProblemMeshType
                                            typename ProblemType::ProblemInputType& problem_input,
                                            Communicator& communicator,
                                            typename ProblemType::ProblemWriterType& writer) {
-    using RawBoundaryType = Geometry::RawBoundary<1, typename ProblemType::ProblemDataType>;
+    using RawBoundaryTableType = Geometry::RawBoundaryTable<1, typename ProblemType::ProblemDataType>;
+
+    std::map<uchar, RawBoundaryTableType> raw_boundaries;
+
+    std::vector<std::pair<std::string, std::chrono::steady_clock::duration>> timings;
 
-    std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>> raw_boundaries;
+    auto t_start = std::chrono::steady_clock::now();
+    auto stop    = [&timings, &t_start](std::string&& stage) {
+        auto t_end = std::chrono::steady_clock::now();
+
+        timings.emplace_back(std::move(stage), t_end - t_start);
+
+        t_start = t_end;
+    };
 
     mesh.CallForEachElement([&raw_boundaries](auto& elem) { elem.CreateRawBoundaries(raw_boundaries); });
 
+    // matching raw boundaries of neighboring elements amounts to sorting by key
+    for (auto& raw_bound_table : raw_boundaries) {
+        raw_bound_table.second.Sort();
+    }
+
+    stop("match raw boundaries");
+
     ProblemType::create_interfaces(raw_boundaries, mesh, problem_input, writer);
+
+    stop("create interfaces");
+
     ProblemType::create_boundaries(raw_boundaries, mesh, problem_input, writer);
+
+    stop("create boundaries");
+
     ProblemType::create_distributed_boundaries(raw_boundaries, mesh, problem_input, communicator, writer);
 
+    stop("create distributed boundaries");
+
     for (auto it = raw_boundaries.begin(); it != raw_boundaries.end(); ++it) {
         if (it->second.size() != 0) {
             throw std::logic_error("Fatal Error: unprocessed raw_boundaries of boundary type " +
                                    std::to_string(it->first) + "!\n");
         }
     }
+
+    if (writer.WritingLog()) {
+        for (auto& timing : timings) {
+            writer.GetLogFile() << "Time to " << timing.first << ": "
+                                << std::chrono::duration<double>(timing.second).count() << " s" << std::endl;
+        }
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
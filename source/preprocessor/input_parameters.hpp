@@ -37,6 +37,7 @@ struct StepperInput {
 
     uint nstages;
     uint order;
+    std::string method;
 
     double ramp_duration;
 };
@@ -163,6 +164,10 @@ InputParameters<ProblemInput>::InputParameters(const std::string& input_string)
             this->stepper_input.order   = time_stepping["order"].as<uint>();
             this->stepper_input.nstages = time_stepping["nstages"].as<uint>();
 
+            if (time_stepping["method"]) {
+                this->stepper_input.method = time_stepping["method"].as<std::string>();
+            }
+
             this->stepper_input.ramp_duration =
                 time_stepping["ramp_duration"] ? time_stepping["ramp_duration"].as<double>() : 0;
         } else {
@@ -334,6 +339,10 @@ void InputParameters<ProblemInput>::write_to(const std::string& output_filename)
     timestepping["nstages"]       = this->stepper_input.nstages;
     timestepping["ramp_duration"] = this->stepper_input.ramp_duration;
 
+    if (!this->stepper_input.method.empty()) {
+        timestepping["method"] = this->stepper_input.method;
+    }
+
     output << YAML::Key << "timestepping";
     output << YAML::Value << timestepping;
 
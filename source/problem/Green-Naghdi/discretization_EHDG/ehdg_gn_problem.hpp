@@ -96,37 +96,37 @@ struct Problem {
         return offset;
     }
 
-    template <typename RawBoundaryType>
-    static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    static std::vector<uint> single_precision_comms() { return SWE_SIM::Problem::single_precision_comms(); }
+
+    template <typename RawBoundaryTableType>
+    static void create_interfaces(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         GN::create_interfaces<GN::EHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    template <typename RawBoundaryTableType>
+    static void create_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         GN::create_boundaries<GN::EHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType&,
-        ProblemInputType& problem_input,
-        std::tuple<>&,
-        ProblemWriterType&) {}
-
-    template <typename RawBoundaryType, typename Communicator>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType& mesh,
-        ProblemInputType& input,
-        Communicator& communicator,
-        ProblemWriterType& writer) {
+    template <typename RawBoundaryTableType>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType&,
+                                              ProblemInputType& problem_input,
+                                              std::tuple<>&,
+                                              ProblemWriterType&) {}
+
+    template <typename RawBoundaryTableType, typename Communicator>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType& mesh,
+                                              ProblemInputType& input,
+                                              Communicator& communicator,
+                                              ProblemWriterType& writer) {
         // *** //
         GN::create_distributed_boundaries<GN::EHDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
@@ -184,6 +184,8 @@ struct Problem {
                                                     const uint begin_sim_id,
                                                     const uint end_sim_id);
 
+    static void compute_static_dc_operators(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
+
     // processor kernels
     static void step_serial(ProblemDiscretizationType& discretization,
                             ProblemGlobalDataType& global_data,
@@ -287,6 +289,13 @@ struct Problem {
         global_data.destroy();
 #endif
     }
+
+    static constexpr bool ompi_repartitioning = false;
+
+    template <typename OMPIReducerType>
+    static void initialize_reductions_ompi(OMPIReducerType&) {}
+
+    static void monitor_reductions_ompi(const std::vector<double>&, const std::vector<double>&, const bool) {}
 };
 }
 }
@@ -17,11 +17,10 @@ void Problem::compute_bathymetry_derivatives_ompi(std::vector<std::unique_ptr<OM
 
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary([](auto& dbound) {
             auto& derivative = dbound.data.derivative;
-            std::vector<double> message(GN::n_dimensions);
+            auto message = dbound.boundary_condition.exchanger.GetSendMessage(CommTypes::dbath, GN::n_dimensions);
             for (uint dbath = 0; dbath < GN::n_dimensions; ++dbath) {
                 message[dbath] = derivative.dbath_at_baryctr[dbath];
             }
-            dbound.boundary_condition.exchanger.SetToSendBuffer(CommTypes::dbath, message);
         });
 
         sim_units[su_id]->communicator.SendAll(CommTypes::dbath, 0);
@@ -49,7 +48,8 @@ void Problem::compute_bathymetry_derivatives_ompi(std::vector<std::unique_ptr<OM
             auto& boundary   = dbound.data.boundary[dbound.bound_id];
 
             const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
-            std::vector<double> message(GN::n_ddbath_terms + GN::n_dimensions * ngp);
+            auto message = dbound.boundary_condition.exchanger.GetSendMessage(
+                CommTypes::dbath, GN::n_ddbath_terms + GN::n_dimensions * ngp);
             for (uint ddbath = 0; ddbath < GN::n_ddbath_terms; ++ddbath) {
                 message[ddbath] = derivative.ddbath_at_baryctr[ddbath];
             }
@@ -58,7 +58,6 @@ void Problem::compute_bathymetry_derivatives_ompi(std::vector<std::unique_ptr<OM
                     message[GN::n_ddbath_terms + GN::n_dimensions * gp + dbath] = boundary.dbath_hat_at_gp(dbath, gp);
                 }
             }
-            dbound.boundary_condition.exchanger.SetToSendBuffer(CommTypes::dbath, message);
         });
 
         sim_units[su_id]->communicator.SendAll(CommTypes::dbath, 0);
@@ -83,11 +82,10 @@ void Problem::compute_bathymetry_derivatives_ompi(std::vector<std::unique_ptr<OM
 
         sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary([](auto& dbound) {
             auto& derivative = dbound.data.derivative;
-            std::vector<double> message(GN::n_dddbath_terms);
+            auto message = dbound.boundary_condition.exchanger.GetSendMessage(CommTypes::dbath, GN::n_dddbath_terms);
             for (uint dddbath = 0; dddbath < GN::n_dddbath_terms; ++dddbath) {
                 message[dddbath] = derivative.dddbath_at_baryctr[dddbath];
             }
-            dbound.boundary_condition.exchanger.SetToSendBuffer(CommTypes::dbath, message);
         });
 
         sim_units[su_id]->communicator.SendAll(CommTypes::dbath, 0);
@@ -94,8 +94,7 @@ void compute_dbath(ProblemDiscretizationType& discretization) {
 
     discretization.mesh.CallForEachDistributedBoundary([](auto& dbound) {
         auto& derivative = dbound.data.derivative;
-        std::vector<double> message(GN::n_dimensions);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::dbath, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::dbath, GN::n_dimensions);
         for (uint dbath = 0; dbath < GN::n_dimensions; ++dbath) {
             derivative.dbath_at_baryctr_neigh[dbound.bound_id][dbath] = message[dbath];
         }
@@ -216,8 +215,8 @@ void compute_ddbath(ProblemDiscretizationType& discretization) {
         auto& boundary   = dbound.data.boundary[dbound.bound_id];
 
         const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
-        std::vector<double> message(GN::n_ddbath_terms + GN::n_dimensions * ngp);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::dbath, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(
+            CommTypes::dbath, GN::n_ddbath_terms + GN::n_dimensions * ngp);
         for (uint ddbath = 0; ddbath < GN::n_ddbath_terms; ++ddbath) {
             derivative.ddbath_at_baryctr_neigh[dbound.bound_id][ddbath] = message[ddbath];
         }
@@ -328,8 +327,7 @@ void compute_dddbath(ProblemDiscretizationType& discretization) {
 
     discretization.mesh.CallForEachDistributedBoundary([](auto& dbound) {
         auto& derivative = dbound.data.derivative;
-        std::vector<double> message(GN::n_dddbath_terms);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::dbath, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::dbath, GN::n_dddbath_terms);
         for (uint dddbath = 0; dddbath < GN::n_dddbath_terms; ++dddbath) {
             derivative.dddbath_at_baryctr_neigh[dbound.bound_id][dddbath] = message[dddbath];
         }
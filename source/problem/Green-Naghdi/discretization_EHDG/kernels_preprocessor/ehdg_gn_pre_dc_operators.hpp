@@ -0,0 +1,299 @@
+#ifndef EHDG_GN_PRE_DC_OPERATORS_HPP
+#define EHDG_GN_PRE_DC_OPERATORS_HPP
+
+namespace GN {
+namespace EHDG {
+void Problem::compute_static_dc_operators(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
+    // Parts of the dispersive correction operators that depend only on geometry,
+    // bathymetry and stabilization are integrated once here, at each stage
+    // the local kernels add the solution dependent parts on top of them
+    discretization.mesh.CallForEachElement([](auto& elt) {
+        auto& internal = elt.data.internal;
+
+        const auto bx = row(internal.dbath_at_gp, GlobalCoord::x);
+        const auto by = row(internal.dbath_at_gp, GlobalCoord::y);
+
+        set_constant(internal.w1_w1_kernel_at_gp, 0.0);
+        set_constant(row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xx), 1.0);
+        set_constant(row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yy), 1.0);
+        row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xx) += NDParameters::alpha * vec_cw_mult(bx, bx);
+        row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xy) += NDParameters::alpha * vec_cw_mult(bx, by);
+        row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yx) += NDParameters::alpha * vec_cw_mult(by, bx);
+        row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yy) += NDParameters::alpha * vec_cw_mult(by, by);
+
+        set_constant(internal.w1_w2_kernel_at_gp, -NDParameters::alpha / 3.0);
+
+        for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < elt.data.get_ndof(); ++dof_j) {
+                submatrix(internal.w1_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(elt.IntegrationPhiPhi(dof_i, dof_j, internal.w1_w1_kernel_at_gp));
+                internal.w1_w2_static(GN::n_dimensions * dof_i + GlobalCoord::x, dof_j) = elt.IntegrationPhiDPhi(
+                    dof_i, GlobalCoord::x, dof_j, row(internal.w1_w2_kernel_at_gp, GlobalCoord::x));
+                internal.w1_w2_static(GN::n_dimensions * dof_i + GlobalCoord::y, dof_j) = elt.IntegrationPhiDPhi(
+                    dof_i, GlobalCoord::y, dof_j, row(internal.w1_w2_kernel_at_gp, GlobalCoord::y));
+            }
+        }
+    });
+
+    discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
+        auto& edge_internal = edge_int.edge_data.edge_internal;
+        auto& internal_in   = edge_int.interface.data_in.internal;
+        auto& internal_ex   = edge_int.interface.data_ex.internal;
+        auto& boundary_in   = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+        auto& boundary_ex   = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+        double tau = -20;  // hardcode the tau value here
+
+        set_constant(boundary_in.w1_w1_kernel_at_gp, 0.0);
+        set_constant(row(boundary_in.w1_w1_kernel_at_gp, RowMajTrans2D::xx), -NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary_in.w1_w1_kernel_at_gp, RowMajTrans2D::yy), -NDParameters::alpha / 3.0 * tau);
+        boundary_ex.w1_w1_kernel_at_gp = boundary_in.w1_w1_kernel_at_gp;
+
+        set_constant(boundary_in.w1_w1_hat_kernel_at_gp, 0.0);
+        set_constant(row(boundary_in.w1_w1_hat_kernel_at_gp, RowMajTrans2D::xx), NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary_in.w1_w1_hat_kernel_at_gp, RowMajTrans2D::yy), NDParameters::alpha / 3.0 * tau);
+        boundary_ex.w1_w1_hat_kernel_at_gp = boundary_in.w1_w1_hat_kernel_at_gp;
+
+        for (uint dof_i = 0; dof_i < edge_int.interface.data_in.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.interface.data_in.get_ndof(); ++dof_j) {
+                submatrix(internal_in.w1_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) +=
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.interface.IntegrationPhiPhiIN(dof_i, dof_j, boundary_in.w1_w1_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_int.interface.data_in.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.edge_data.get_ndof(); ++dof_j) {
+                submatrix(boundary_in.w1_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.IntegrationPhiLambdaIN(dof_i, dof_j, boundary_in.w1_w1_hat_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_int.interface.data_ex.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.interface.data_ex.get_ndof(); ++dof_j) {
+                submatrix(internal_ex.w1_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) +=
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.interface.IntegrationPhiPhiEX(dof_i, dof_j, boundary_ex.w1_w1_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_int.interface.data_ex.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.edge_data.get_ndof(); ++dof_j) {
+                submatrix(boundary_ex.w1_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.IntegrationPhiLambdaEX(dof_i, dof_j, boundary_ex.w1_w1_hat_kernel_at_gp));
+            }
+        }
+
+        edge_int.interface.specialization.ComputeGlobalKernelsDC(edge_int);
+
+        for (uint dof_i = 0; dof_i < edge_int.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.edge_data.get_ndof(); ++dof_j) {
+                submatrix(edge_internal.w1_hat_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.IntegrationLambdaLambda(dof_i, dof_j, edge_internal.w1_hat_w1_hat_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_int.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.interface.data_in.get_ndof(); ++dof_j) {
+                submatrix(boundary_in.w1_hat_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.IntegrationPhiLambdaIN(dof_j, dof_i, boundary_in.w1_hat_w1_kernel_at_gp));
+                boundary_in.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::x, dof_j) =
+                    edge_int.IntegrationPhiLambdaIN(
+                        dof_j, dof_i, row(boundary_in.w1_hat_w2_kernel_at_gp, GlobalCoord::x));
+                boundary_in.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::y, dof_j) =
+                    edge_int.IntegrationPhiLambdaIN(
+                        dof_j, dof_i, row(boundary_in.w1_hat_w2_kernel_at_gp, GlobalCoord::y));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_int.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_int.interface.data_ex.get_ndof(); ++dof_j) {
+                submatrix(boundary_ex.w1_hat_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_int.IntegrationPhiLambdaEX(dof_j, dof_i, boundary_ex.w1_hat_w1_kernel_at_gp));
+                boundary_ex.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::x, dof_j) =
+                    edge_int.IntegrationPhiLambdaEX(
+                        dof_j, dof_i, row(boundary_ex.w1_hat_w2_kernel_at_gp, GlobalCoord::x));
+                boundary_ex.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::y, dof_j) =
+                    edge_int.IntegrationPhiLambdaEX(
+                        dof_j, dof_i, row(boundary_ex.w1_hat_w2_kernel_at_gp, GlobalCoord::y));
+            }
+        }
+    });
+
+    discretization.mesh_skeleton.CallForEachEdgeBoundary([&stepper](auto& edge_bound) {
+        auto& edge_internal = edge_bound.edge_data.edge_internal;
+        auto& internal      = edge_bound.boundary.data.internal;
+        auto& boundary      = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+        double tau = -20;  // hardcode the tau value here
+
+        set_constant(boundary.w1_w1_kernel_at_gp, 0.0);
+        set_constant(row(boundary.w1_w1_kernel_at_gp, RowMajTrans2D::xx), -NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary.w1_w1_kernel_at_gp, RowMajTrans2D::yy), -NDParameters::alpha / 3.0 * tau);
+
+        set_constant(boundary.w1_w1_hat_kernel_at_gp, 0.0);
+        set_constant(row(boundary.w1_w1_hat_kernel_at_gp, RowMajTrans2D::xx), NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary.w1_w1_hat_kernel_at_gp, RowMajTrans2D::yy), NDParameters::alpha / 3.0 * tau);
+
+        for (uint dof_i = 0; dof_i < edge_bound.boundary.data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_bound.boundary.data.get_ndof(); ++dof_j) {
+                submatrix(internal.w1_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) +=
+                    reshape<double, GN::n_dimensions>(
+                        edge_bound.boundary.IntegrationPhiPhi(dof_i, dof_j, boundary.w1_w1_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_bound.boundary.data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_bound.edge_data.get_ndof(); ++dof_j) {
+                submatrix(boundary.w1_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_bound.IntegrationPhiLambda(dof_i, dof_j, boundary.w1_w1_hat_kernel_at_gp));
+            }
+        }
+
+        edge_bound.boundary.boundary_condition.ComputeGlobalKernelsDC(stepper, edge_bound);
+
+        for (uint dof_i = 0; dof_i < edge_bound.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_bound.edge_data.get_ndof(); ++dof_j) {
+                submatrix(edge_internal.w1_hat_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_bound.IntegrationLambdaLambda(dof_i, dof_j, edge_internal.w1_hat_w1_hat_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_bound.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_bound.boundary.data.get_ndof(); ++dof_j) {
+                submatrix(boundary.w1_hat_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_bound.IntegrationPhiLambda(dof_j, dof_i, boundary.w1_hat_w1_kernel_at_gp));
+            }
+        }
+    });
+
+    discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
+        auto& edge_internal = edge_dbound.edge_data.edge_internal;
+        auto& internal      = edge_dbound.boundary.data.internal;
+        auto& boundary      = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+        double tau = -20;  // hardcode the tau value here
+
+        set_constant(boundary.w1_w1_kernel_at_gp, 0.0);
+        set_constant(row(boundary.w1_w1_kernel_at_gp, RowMajTrans2D::xx), -NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary.w1_w1_kernel_at_gp, RowMajTrans2D::yy), -NDParameters::alpha / 3.0 * tau);
+
+        set_constant(boundary.w1_w1_hat_kernel_at_gp, 0.0);
+        set_constant(row(boundary.w1_w1_hat_kernel_at_gp, RowMajTrans2D::xx), NDParameters::alpha / 3.0 * tau);
+        set_constant(row(boundary.w1_w1_hat_kernel_at_gp, RowMajTrans2D::yy), NDParameters::alpha / 3.0 * tau);
+
+        for (uint dof_i = 0; dof_i < edge_dbound.boundary.data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_dbound.boundary.data.get_ndof(); ++dof_j) {
+                submatrix(internal.w1_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) +=
+                    reshape<double, GN::n_dimensions>(
+                        edge_dbound.boundary.IntegrationPhiPhi(dof_i, dof_j, boundary.w1_w1_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_dbound.boundary.data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_dbound.edge_data.get_ndof(); ++dof_j) {
+                submatrix(boundary.w1_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_dbound.IntegrationPhiLambda(dof_i, dof_j, boundary.w1_w1_hat_kernel_at_gp));
+            }
+        }
+
+        edge_dbound.boundary.boundary_condition.ComputeGlobalKernelsDC(edge_dbound);
+
+        for (uint dof_i = 0; dof_i < edge_dbound.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_dbound.edge_data.get_ndof(); ++dof_j) {
+                submatrix(edge_internal.w1_hat_w1_hat_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_dbound.IntegrationLambdaLambda(dof_i, dof_j, edge_internal.w1_hat_w1_hat_kernel_at_gp));
+            }
+        }
+
+        for (uint dof_i = 0; dof_i < edge_dbound.edge_data.get_ndof(); ++dof_i) {
+            for (uint dof_j = 0; dof_j < edge_dbound.boundary.data.get_ndof(); ++dof_j) {
+                submatrix(boundary.w1_hat_w1_static,
+                          GN::n_dimensions * dof_i,
+                          GN::n_dimensions * dof_j,
+                          GN::n_dimensions,
+                          GN::n_dimensions) =
+                    reshape<double, GN::n_dimensions>(
+                        edge_dbound.IntegrationPhiLambda(dof_j, dof_i, boundary.w1_hat_w1_kernel_at_gp));
+                boundary.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::x, dof_j) = edge_dbound.IntegrationPhiLambda(
+                    dof_j, dof_i, row(boundary.w1_hat_w2_kernel_at_gp, GlobalCoord::x));
+                boundary.w1_hat_w2(GN::n_dimensions * dof_i + GlobalCoord::y, dof_j) = edge_dbound.IntegrationPhiLambda(
+                    dof_j, dof_i, row(boundary.w1_hat_w2_kernel_at_gp, GlobalCoord::y));
+            }
+        }
+    });
+}
+}
+}
+
+#endif
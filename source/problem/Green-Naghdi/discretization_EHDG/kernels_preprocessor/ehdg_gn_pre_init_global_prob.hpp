@@ -13,9 +13,16 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         internal.w1_w2.resize(GN::n_dimensions * elt.data.get_ndof(), elt.data.get_ndof());
         internal.w1_rhs.resize(GN::n_dimensions * elt.data.get_ndof());
 
+        internal.w1_w1_static.resize(GN::n_dimensions * elt.data.get_ndof(), GN::n_dimensions * elt.data.get_ndof());
+        internal.w1_w2_static.resize(GN::n_dimensions * elt.data.get_ndof(), elt.data.get_ndof());
+
         // Initialize w2 containers
         internal.w2_w1.resize(elt.data.get_ndof(), GN::n_dimensions * elt.data.get_ndof());
         internal.w2_w2.resize(elt.data.get_ndof(), elt.data.get_ndof());
+
+        // Initialize matrix-free global problem containers
+        internal.w1_local.resize(GN::n_dimensions * elt.data.get_ndof());
+        internal.w2_local.resize(elt.data.get_ndof());
     });
 
     discretization.mesh_skeleton.CallForEachEdgeInterface([&dc_global_dof_offset](auto& edge_int) {
@@ -44,6 +51,11 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         boundary_ex.w1_w1_hat.resize(GN::n_dimensions * edge_int.interface.data_ex.get_ndof(),
                                      GN::n_dimensions * edge_int.edge_data.get_ndof());
 
+        boundary_in.w1_w1_hat_static.resize(GN::n_dimensions * edge_int.interface.data_in.get_ndof(),
+                                            GN::n_dimensions * edge_int.edge_data.get_ndof());
+        boundary_ex.w1_w1_hat_static.resize(GN::n_dimensions * edge_int.interface.data_ex.get_ndof(),
+                                            GN::n_dimensions * edge_int.edge_data.get_ndof());
+
         // Initialize w2 containers
         boundary_in.w2_w1_hat.resize(edge_int.interface.data_in.get_ndof(),
                                      GN::n_dimensions * edge_int.edge_data.get_ndof());
@@ -53,6 +65,8 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         // Initialize w1_hat containers
         edge_internal.w1_hat_w1_hat.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
                                            GN::n_dimensions * edge_int.edge_data.get_ndof());
+        edge_internal.w1_hat_w1_hat_static.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
+                                                  GN::n_dimensions * edge_int.edge_data.get_ndof());
         edge_internal.w1_hat_rhs.resize(GN::n_dimensions * edge_int.edge_data.get_ndof());
 
         boundary_in.w1_hat_w1.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
@@ -60,6 +74,11 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         boundary_ex.w1_hat_w1.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
                                      GN::n_dimensions * edge_int.interface.data_ex.get_ndof());
 
+        boundary_in.w1_hat_w1_static.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
+                                            GN::n_dimensions * edge_int.interface.data_in.get_ndof());
+        boundary_ex.w1_hat_w1_static.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
+                                            GN::n_dimensions * edge_int.interface.data_ex.get_ndof());
+
         boundary_in.w1_hat_w2.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
                                      edge_int.interface.data_in.get_ndof());
         boundary_ex.w1_hat_w2.resize(GN::n_dimensions * edge_int.edge_data.get_ndof(),
@@ -87,6 +106,8 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         // Initialize w1 containers
         boundary.w1_w1_hat.resize(GN::n_dimensions * edge_bound.boundary.data.get_ndof(),
                                   GN::n_dimensions * edge_bound.edge_data.get_ndof());
+        boundary.w1_w1_hat_static.resize(GN::n_dimensions * edge_bound.boundary.data.get_ndof(),
+                                         GN::n_dimensions * edge_bound.edge_data.get_ndof());
         edge_internal.w1_hat_rhs.resize(GN::n_dimensions * edge_bound.edge_data.get_ndof());
 
         // Initialize w2 containers
@@ -96,9 +117,13 @@ void Problem::initialize_global_dc_problem_serial(ProblemDiscretizationType& dis
         // Initialize w1_hat containers
         edge_internal.w1_hat_w1_hat.resize(GN::n_dimensions * edge_bound.edge_data.get_ndof(),
                                            GN::n_dimensions * edge_bound.edge_data.get_ndof());
+        edge_internal.w1_hat_w1_hat_static.resize(GN::n_dimensions * edge_bound.edge_data.get_ndof(),
+                                                  GN::n_dimensions * edge_bound.edge_data.get_ndof());
 
         boundary.w1_hat_w1.resize(GN::n_dimensions * edge_bound.edge_data.get_ndof(),
                                   GN::n_dimensions * edge_bound.boundary.data.get_ndof());
+        boundary.w1_hat_w1_static.resize(GN::n_dimensions * edge_bound.edge_data.get_ndof(),
+                                         GN::n_dimensions * edge_bound.boundary.data.get_ndof());
     });
 }
 
@@ -136,6 +161,8 @@ void Problem::initialize_global_dc_problem_parallel_pre_send(ProblemDiscretizati
         // Initialize w1 containers
         boundary.w1_w1_hat.resize(GN::n_dimensions * edge_dbound.boundary.data.get_ndof(),
                                   GN::n_dimensions * edge_dbound.edge_data.get_ndof());
+        boundary.w1_w1_hat_static.resize(GN::n_dimensions * edge_dbound.boundary.data.get_ndof(),
+                                         GN::n_dimensions * edge_dbound.edge_data.get_ndof());
 
         // Initialize w2 containers
         boundary.w2_w1_hat.resize(edge_dbound.boundary.data.get_ndof(),
@@ -144,10 +171,14 @@ void Problem::initialize_global_dc_problem_parallel_pre_send(ProblemDiscretizati
         // Initialize w1_hat containers
         edge_internal.w1_hat_w1_hat.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof(),
                                            GN::n_dimensions * edge_dbound.edge_data.get_ndof());
+        edge_internal.w1_hat_w1_hat_static.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof(),
+                                                  GN::n_dimensions * edge_dbound.edge_data.get_ndof());
         edge_internal.w1_hat_rhs.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof());
 
         boundary.w1_hat_w1.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof(),
                                   GN::n_dimensions * edge_dbound.boundary.data.get_ndof());
+        boundary.w1_hat_w1_static.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof(),
+                                         GN::n_dimensions * edge_dbound.boundary.data.get_ndof());
 
         boundary.w1_hat_w2.resize(GN::n_dimensions * edge_dbound.edge_data.get_ndof(),
                                   edge_dbound.boundary.data.get_ndof());
@@ -208,11 +239,10 @@ void Problem::initialize_global_dc_problem_parallel_finalize_pre_send(ProblemDis
 
             boundary.dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-            std::vector<double> message(1);
+            auto message =
+                edge_dbound.boundary.boundary_condition.exchanger.GetSendMessage(CommTypes::dc_global_dof_indx, 1);
 
             message[0] = (double)edge_internal.dc_global_dof_indx[0];
-
-            edge_dbound.boundary.boundary_condition.exchanger.SetToSendBuffer(CommTypes::dc_global_dof_indx, message);
         }
     });
 }
@@ -259,10 +289,8 @@ void Problem::initialize_global_dc_problem_parallel_post_receive(ProblemDiscreti
         uint submesh_ex  = edge_dbound.boundary.boundary_condition.exchanger.submesh_ex;
 
         if (locality_in > locality_ex || (locality_in == locality_ex && submesh_in > submesh_ex)) {
-            std::vector<double> message(1);
-
-            edge_dbound.boundary.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::dc_global_dof_indx,
-                                                                                   message);
+            auto message =
+                edge_dbound.boundary.boundary_condition.exchanger.GetReceiveMessage(CommTypes::dc_global_dof_indx, 1);
 
             uint dc_global_dof_offset = (uint)message[0];
 
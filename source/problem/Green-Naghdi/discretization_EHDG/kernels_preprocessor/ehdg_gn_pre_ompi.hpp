@@ -3,6 +3,7 @@
 
 #include "problem/Green-Naghdi/problem_preprocessor/gn_pre_init_data.hpp"
 #include "ehdg_gn_pre_dbath_ompi.hpp"
+#include "ehdg_gn_pre_dc_operators.hpp"
 
 namespace GN {
 namespace EHDG {
@@ -66,6 +67,8 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType>>& s
             }
         }
 
+        const uint n_local_dc_global_dofs = total_dc_global_dof_offset;
+
         int n_localities;
         int locality_id;
 
@@ -107,17 +110,52 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType>>& s
 
         MPI_Bcast(&n_dc_global_dofs, 1, MPI_UNSIGNED, 0, MPI_COMM_WORLD);
 
-        MatCreate(MPI_COMM_WORLD, &(global_data.w1_hat_w1_hat));
-        MatSetSizes(global_data.w1_hat_w1_hat, PETSC_DECIDE, PETSC_DECIDE, n_dc_global_dofs, n_dc_global_dofs);
-        MatSetUp(global_data.w1_hat_w1_hat);
-
-        VecCreateMPI(MPI_COMM_WORLD, PETSC_DECIDE, n_dc_global_dofs, &(global_data.w1_hat_rhs));
-
-        KSPCreate(MPI_COMM_WORLD, &(global_data.dc_ksp));
-        KSPSetOperators(global_data.dc_ksp, global_data.w1_hat_w1_hat, global_data.w1_hat_w1_hat);
-
-        KSPGetPC(global_data.dc_ksp, &(global_data.dc_pc));
-        PCSetType(global_data.dc_pc, PCLU);
+        if (SWE::GlobalProblem::matrix_free) {
+            MatCreateShell(MPI_COMM_WORLD,
+                           n_local_dc_global_dofs,
+                           n_local_dc_global_dofs,
+                           n_dc_global_dofs,
+                           n_dc_global_dofs,
+                           &(global_data.w1_hat_w1_hat_apply),
+                           &(global_data.w1_hat_w1_hat));
+            MatShellSetOperation(
+                global_data.w1_hat_w1_hat, MATOP_MULT, (void (*)(void))SWE::GlobalData::apply_matrix_free);
+
+            MatCreate(MPI_COMM_WORLD, &(global_data.w1_hat_w1_hat_precon));
+            MatSetSizes(global_data.w1_hat_w1_hat_precon,
+                        n_local_dc_global_dofs,
+                        n_local_dc_global_dofs,
+                        n_dc_global_dofs,
+                        n_dc_global_dofs);
+            MatSetUp(global_data.w1_hat_w1_hat_precon);
+
+            VecCreateMPI(MPI_COMM_WORLD, n_local_dc_global_dofs, n_dc_global_dofs, &(global_data.w1_hat_rhs));
+
+            KSPCreate(MPI_COMM_WORLD, &(global_data.dc_ksp));
+            KSPSetOperators(global_data.dc_ksp, global_data.w1_hat_w1_hat, global_data.w1_hat_w1_hat_precon);
+            KSPSetType(global_data.dc_ksp, KSPGMRES);
+            KSPGMRESSetRestart(global_data.dc_ksp, SWE::GlobalProblem::restart);
+            KSPSetTolerances(global_data.dc_ksp,
+                             SWE::GlobalProblem::tolerance,
+                             PETSC_DEFAULT,
+                             PETSC_DEFAULT,
+                             SWE::GlobalProblem::max_iterations);
+
+            KSPGetPC(global_data.dc_ksp, &(global_data.dc_pc));
+            PCSetType(global_data.dc_pc, PCBJACOBI);
+        } else {
+            MatCreate(MPI_COMM_WORLD, &(global_data.w1_hat_w1_hat));
+            MatSetSizes(global_data.w1_hat_w1_hat, PETSC_DECIDE, PETSC_DECIDE, n_dc_global_dofs, n_dc_global_dofs);
+            MatSetUp(global_data.w1_hat_w1_hat);
+
+            VecCreateMPI(MPI_COMM_WORLD, PETSC_DECIDE, n_dc_global_dofs, &(global_data.w1_hat_rhs));
+
+            KSPCreate(MPI_COMM_WORLD, &(global_data.dc_ksp));
+            KSPSetOperators(global_data.dc_ksp, global_data.w1_hat_w1_hat, global_data.w1_hat_w1_hat);
+
+            KSPGetPC(global_data.dc_ksp, &(global_data.dc_pc));
+            PCSetType(global_data.dc_pc, PCLU);
+        }
 
         MPI_Scatter(&total_dc_global_dof_offsets.front(),
                     1,
@@ -174,6 +212,10 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType>>& s
 
     Problem::compute_bathymetry_derivatives_ompi(sim_units, begin_sim_id, end_sim_id);
 
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        Problem::compute_static_dc_operators(sim_units[su_id]->discretization, stepper.GetSecondStepper());
+    }
+
     uint n_stages = stepper.GetFirstStepper().GetNumStages() > stepper.GetSecondStepper().GetNumStages()
                         ? stepper.GetFirstStepper().GetNumStages()
                         : stepper.GetSecondStepper().GetNumStages();
@@ -3,6 +3,7 @@
 
 #include "problem/Green-Naghdi/problem_preprocessor/gn_pre_init_data.hpp"
 #include "ehdg_gn_pre_dbath_serial.hpp"
+#include "ehdg_gn_pre_dc_operators.hpp"
 
 namespace GN {
 namespace EHDG {
@@ -22,6 +23,8 @@ void Problem::preprocessor_serial(ProblemDiscretizationType& discretization,
 
     Problem::compute_bathymetry_derivatives_serial(discretization);
 
+    Problem::compute_static_dc_operators(discretization, stepper.GetSecondStepper());
+
     uint n_stages = stepper.GetFirstStepper().GetNumStages() > stepper.GetSecondStepper().GetNumStages()
                         ? stepper.GetFirstStepper().GetNumStages()
                         : stepper.GetSecondStepper().GetNumStages();
@@ -4,32 +4,63 @@
 namespace GN {
 namespace EHDG {
 template <typename ProblemDiscretizationType>
-void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
-template <typename ProblemDiscretizationType>
-void compute_du_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
+void compute_dze_du_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
 template <typename ProblemDiscretizationType>
 void compute_ddu_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
 
 template <typename ProblemDiscretizationType>
-void compute_dze(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
-template <typename ProblemDiscretizationType>
-void compute_du(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
+void compute_dze_du(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
 template <typename ProblemDiscretizationType>
 void compute_ddu(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper);
 
 void Problem::compute_derivatives_serial(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
-    compute_dze_avg(discretization, stepper);
-    compute_dze(discretization, stepper);
-
-    compute_du_avg(discretization, stepper);
-    compute_du(discretization, stepper);
+    compute_dze_du_avg(discretization, stepper);
+    compute_dze_du(discretization, stepper);
 
     compute_ddu_avg(discretization, stepper);
     compute_ddu(discretization, stepper);
 }
 
+// Kernels for the boundary integrals of ze * n and u * n, stacked so that the barycenter averages
+// of dze and du are obtained with a single integration
+template <typename BoundaryType, typename NormalType>
+void set_dze_du_kernel(BoundaryType& boundary, const NormalType& surface_normal) {
+    for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
+        row(boundary.dze_du_kernel_at_gp, dir) =
+            vec_cw_mult(row(boundary.q_at_gp, SWE::Variables::ze), row(surface_normal, dir));
+    }
+
+    for (uint u = 0; u < GN::n_dimensions; ++u) {
+        const uint du_x = GN::n_dimensions + GN::n_dimensions * u + GlobalCoord::x;
+        const uint du_y = GN::n_dimensions + GN::n_dimensions * u + GlobalCoord::y;
+
+        row(boundary.dze_du_kernel_at_gp, du_x) =
+            vec_cw_div(row(boundary.q_at_gp, SWE::Variables::qx + u), row(boundary.aux_at_gp, SWE::Auxiliaries::h));
+        row(boundary.dze_du_kernel_at_gp, du_y) =
+            vec_cw_mult(row(boundary.dze_du_kernel_at_gp, du_x), row(surface_normal, GlobalCoord::y));
+        row(boundary.dze_du_kernel_at_gp, du_x) =
+            vec_cw_mult(row(boundary.dze_du_kernel_at_gp, du_x), row(surface_normal, GlobalCoord::x));
+    }
+}
+
+template <typename BoundaryType, typename ArrayType, typename NormalType>
+void set_ddu_kernel(BoundaryType& boundary, const ArrayType& du_at_gp, const NormalType& surface_normal) {
+    for (uint du = 0; du < GN::n_du_terms; ++du) {
+        for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
+            row(boundary.ddu_kernel_at_gp, GN::n_dimensions * du + dir) =
+                vec_cw_mult(row(du_at_gp, du), row(surface_normal, dir));
+        }
+    }
+}
+
+template <typename DerivativeType, typename ArrayType>
+void add_dze_du_avg(DerivativeType& derivative, const ArrayType& dze_du_integral) {
+    derivative.dze_at_baryctr += 1.0 / derivative.area * subvector(dze_du_integral, 0, GN::n_dimensions);
+    derivative.du_at_baryctr += 1.0 / derivative.area * subvector(dze_du_integral, GN::n_dimensions, GN::n_du_terms);
+}
+
 template <typename ProblemDiscretizationType>
-void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
+void compute_dze_du_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         const uint stage = stepper.GetStage();
         auto& state      = elt.data.state[stage];
@@ -40,7 +71,13 @@ void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStep
         row(internal.aux_at_gp, SWE::Auxiliaries::h) =
             row(internal.q_at_gp, SWE::Variables::ze) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
 
+        row(internal.u_at_gp, GlobalCoord::x) =
+            vec_cw_div(row(internal.q_at_gp, SWE::Variables::qx), row(internal.aux_at_gp, SWE::Auxiliaries::h));
+        row(internal.u_at_gp, GlobalCoord::y) =
+            vec_cw_div(row(internal.q_at_gp, SWE::Variables::qy), row(internal.aux_at_gp, SWE::Auxiliaries::h));
+
         set_constant(derivative.dze_at_baryctr, 0);
+        set_constant(derivative.du_at_baryctr, 0);
     });
 
     discretization.mesh.CallForEachInterface([&stepper](auto& intface) {
@@ -59,16 +96,16 @@ void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStep
         row(boundary_ex.aux_at_gp, SWE::Auxiliaries::h) =
             row(boundary_ex.q_at_gp, SWE::Variables::ze) + row(boundary_ex.aux_at_gp, SWE::Auxiliaries::bath);
 
-        for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-            row(derivative_in.dze_at_baryctr, dir) +=
-                1.0 / derivative_in.area *
-                intface.IntegrationIN(
-                    vec_cw_mult(row(boundary_in.q_at_gp, SWE::Variables::ze), row(intface.surface_normal_in, dir)));
-            row(derivative_ex.dze_at_baryctr, dir) +=
-                1.0 / derivative_ex.area *
-                intface.IntegrationEX(
-                    vec_cw_mult(row(boundary_ex.q_at_gp, SWE::Variables::ze), row(intface.surface_normal_ex, dir)));
-        }
+        set_dze_du_kernel(boundary_in, intface.surface_normal_in);
+        set_dze_du_kernel(boundary_ex, intface.surface_normal_ex);
+
+        const StatVector<double, GN::n_dimensions + GN::n_du_terms> dze_du_integral_in =
+            intface.IntegrationIN(boundary_in.dze_du_kernel_at_gp);
+        const StatVector<double, GN::n_dimensions + GN::n_du_terms> dze_du_integral_ex =
+            intface.IntegrationEX(boundary_ex.dze_du_kernel_at_gp);
+
+        add_dze_du_avg(derivative_in, dze_du_integral_in);
+        add_dze_du_avg(derivative_ex, dze_du_integral_ex);
     });
 
     discretization.mesh.CallForEachBoundary([&stepper](auto& bound) {
@@ -81,12 +118,12 @@ void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStep
         row(boundary.aux_at_gp, SWE::Auxiliaries::h) =
             row(boundary.q_at_gp, SWE::Variables::ze) + row(boundary.aux_at_gp, SWE::Auxiliaries::bath);
 
-        for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-            row(derivative.dze_at_baryctr, dir) +=
-                1.0 / derivative.area *
-                bound.Integration(
-                    vec_cw_mult(row(boundary.q_at_gp, SWE::Variables::ze), row(bound.surface_normal, dir)));
-        }
+        set_dze_du_kernel(boundary, bound.surface_normal);
+
+        const StatVector<double, GN::n_dimensions + GN::n_du_terms> dze_du_integral =
+            bound.Integration(boundary.dze_du_kernel_at_gp);
+
+        add_dze_du_avg(derivative, dze_du_integral);
     });
 
     discretization.mesh.CallForEachDistributedBoundary([&stepper](auto& dbound) {
@@ -99,27 +136,30 @@ void compute_dze_avg(ProblemDiscretizationType& discretization, const ESSPRKStep
         row(boundary.aux_at_gp, SWE::Auxiliaries::h) =
             row(boundary.q_at_gp, SWE::Variables::ze) + row(boundary.aux_at_gp, SWE::Auxiliaries::bath);
 
-        for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-            row(derivative.dze_at_baryctr, dir) +=
-                1.0 / derivative.area *
-                dbound.Integration(
-                    vec_cw_mult(row(boundary.q_at_gp, SWE::Variables::ze), row(dbound.surface_normal, dir)));
-        }
+        set_dze_du_kernel(boundary, dbound.surface_normal);
+
+        const StatVector<double, GN::n_dimensions + GN::n_du_terms> dze_du_integral =
+            dbound.Integration(boundary.dze_du_kernel_at_gp);
+
+        add_dze_du_avg(derivative, dze_du_integral);
     });
 }
 
 template <typename ProblemDiscretizationType>
-void compute_dze(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
+void compute_dze_du(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
     discretization.mesh.CallForEachInterface([&stepper](auto& intface) {
         auto& derivative_in                                     = intface.data_in.derivative;
         auto& derivative_ex                                     = intface.data_ex.derivative;
         derivative_in.dze_at_baryctr_neigh[intface.bound_id_in] = derivative_ex.dze_at_baryctr;
         derivative_ex.dze_at_baryctr_neigh[intface.bound_id_ex] = derivative_in.dze_at_baryctr;
+        derivative_in.du_at_baryctr_neigh[intface.bound_id_in]  = derivative_ex.du_at_baryctr;
+        derivative_ex.du_at_baryctr_neigh[intface.bound_id_ex]  = derivative_in.du_at_baryctr;
     });
 
     discretization.mesh.CallForEachBoundary([&stepper](auto& bound) {
         auto& derivative                                = bound.data.derivative;
         derivative.dze_at_baryctr_neigh[bound.bound_id] = derivative.dze_at_baryctr;
+        derivative.du_at_baryctr_neigh[bound.bound_id]  = derivative.du_at_baryctr;
     });
 
     discretization.mesh.CallForEachDistributedBoundary([&stepper](auto& dbound) {
@@ -127,8 +167,8 @@ void compute_dze(ProblemDiscretizationType& discretization, const ESSPRKStepper&
         auto& boundary   = dbound.data.boundary[dbound.bound_id];
 
         const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
-        std::vector<double> message(GN::n_dimensions + GN::n_du_terms + ngp);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::derivatives, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::derivatives,
+                                                                             GN::n_dimensions + GN::n_du_terms + ngp);
         for (uint dim = 0; dim < GN::n_dimensions; ++dim) {
             derivative.dze_at_baryctr_neigh[dbound.bound_id][dim] = message[dim];
         }
@@ -147,6 +187,7 @@ void compute_dze(ProblemDiscretizationType& discretization, const ESSPRKStepper&
         const uint stage = stepper.GetStage();
         auto& state      = elt.data.state[stage];
         auto& derivative = elt.data.derivative;
+        auto& internal   = elt.data.internal;
 
         for (uint bound = 0; bound < elt.data.get_nbound(); ++bound) {
             const uint element_1 = derivative.a_elem[2 * bound];
@@ -155,172 +196,61 @@ void compute_dze(ProblemDiscretizationType& discretization, const ESSPRKStepper&
                 derivative.dze_at_baryctr +
                 (derivative.dze_at_baryctr_neigh[element_1] - derivative.dze_at_baryctr) * derivative.a[bound][0] +
                 (derivative.dze_at_baryctr_neigh[element_2] - derivative.dze_at_baryctr) * derivative.a[bound][1];
-        }
-        derivative.dze_lin = derivative.dze_at_midpts * derivative.T;
-        state.dze          = elt.ProjectLinearToBasis(derivative.dze_lin);
-    });
-}
-
-template <typename ProblemDiscretizationType>
-void compute_du_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
-    discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-        auto& derivative = elt.data.derivative;
-        auto& internal   = elt.data.internal;
-
-        row(internal.u_at_gp, GlobalCoord::x) =
-            vec_cw_div(row(internal.q_at_gp, SWE::Variables::qx), row(internal.aux_at_gp, SWE::Auxiliaries::h));
-        row(internal.u_at_gp, GlobalCoord::y) =
-            vec_cw_div(row(internal.q_at_gp, SWE::Variables::qy), row(internal.aux_at_gp, SWE::Auxiliaries::h));
-
-        set_constant(derivative.du_at_baryctr, 0);
-    });
-
-    discretization.mesh.CallForEachInterface([&stepper](auto& intface) {
-        auto& derivative_in = intface.data_in.derivative;
-        auto& derivative_ex = intface.data_ex.derivative;
-        auto& boundary_in   = intface.data_in.boundary[intface.bound_id_in];
-        auto& boundary_ex   = intface.data_ex.boundary[intface.bound_id_ex];
-
-        for (uint u = 0; u < GN::n_dimensions; ++u) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative_in.du_at_baryctr, GN::n_dimensions * u + dir) +=
-                    1.0 / derivative_in.area *
-                    intface.IntegrationIN(vec_cw_mult(vec_cw_div(row(boundary_in.q_at_gp, SWE::Variables::qx + u),
-                                                                 row(boundary_in.aux_at_gp, SWE::Auxiliaries::h)),
-                                                      row(intface.surface_normal_in, dir)));
-                row(derivative_ex.du_at_baryctr, GN::n_dimensions * u + dir) +=
-                    1.0 / derivative_ex.area *
-                    intface.IntegrationEX(vec_cw_mult(vec_cw_div(row(boundary_ex.q_at_gp, SWE::Variables::qx + u),
-                                                                 row(boundary_ex.aux_at_gp, SWE::Auxiliaries::h)),
-                                                      row(intface.surface_normal_ex, dir)));
-            }
-        }
-    });
-
-    discretization.mesh.CallForEachBoundary([&stepper](auto& bound) {
-        auto& derivative = bound.data.derivative;
-        auto& boundary   = bound.data.boundary[bound.bound_id];
-
-        for (uint u = 0; u < GN::n_dimensions; ++u) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative.du_at_baryctr, GN::n_dimensions * u + dir) +=
-                    1.0 / derivative.area *
-                    bound.Integration(vec_cw_mult(vec_cw_div(row(boundary.q_at_gp, SWE::Variables::qx + u),
-                                                             row(boundary.aux_at_gp, SWE::Auxiliaries::h)),
-                                                  row(bound.surface_normal, dir)));
-            }
-        }
-    });
-
-    discretization.mesh.CallForEachDistributedBoundary([&stepper](auto& dbound) {
-        auto& derivative = dbound.data.derivative;
-        auto& boundary   = dbound.data.boundary[dbound.bound_id];
-
-        for (uint u = 0; u < GN::n_dimensions; ++u) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative.du_at_baryctr, GN::n_dimensions * u + dir) +=
-                    1.0 / derivative.area *
-                    dbound.Integration(vec_cw_mult(vec_cw_div(row(boundary.q_at_gp, SWE::Variables::qx + u),
-                                                              row(boundary.aux_at_gp, SWE::Auxiliaries::h)),
-                                                   row(dbound.surface_normal, dir)));
-            }
-        }
-    });
-}
-
-template <typename ProblemDiscretizationType>
-void compute_du(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
-    discretization.mesh.CallForEachInterface([&stepper](auto& intface) {
-        auto& derivative_in                                    = intface.data_in.derivative;
-        auto& derivative_ex                                    = intface.data_ex.derivative;
-        derivative_in.du_at_baryctr_neigh[intface.bound_id_in] = derivative_ex.du_at_baryctr;
-        derivative_ex.du_at_baryctr_neigh[intface.bound_id_ex] = derivative_in.du_at_baryctr;
-    });
-
-    discretization.mesh.CallForEachBoundary([&stepper](auto& bound) {
-        auto& derivative                               = bound.data.derivative;
-        derivative.du_at_baryctr_neigh[bound.bound_id] = derivative.du_at_baryctr;
-    });
-
-    discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-        const uint stage = stepper.GetStage();
-        auto& state      = elt.data.state[stage];
-        auto& derivative = elt.data.derivative;
-        auto& internal   = elt.data.internal;
-
-        for (uint bound = 0; bound < elt.data.get_nbound(); ++bound) {
-            const uint element_1 = derivative.a_elem[2 * bound];
-            const uint element_2 = derivative.a_elem[2 * bound + 1];
             column(derivative.du_at_midpts, bound) =
                 derivative.du_at_baryctr +
                 (derivative.du_at_baryctr_neigh[element_1] - derivative.du_at_baryctr) * derivative.a[bound][0] +
                 (derivative.du_at_baryctr_neigh[element_2] - derivative.du_at_baryctr) * derivative.a[bound][1];
         }
+        derivative.dze_lin = derivative.dze_at_midpts * derivative.T;
+        state.dze          = elt.ProjectLinearToBasis(derivative.dze_lin);
+
         derivative.du_lin = derivative.du_at_midpts * derivative.T;
         state.du          = elt.ProjectLinearToBasis(derivative.du_lin);
         internal.du_at_gp = elt.ComputeUgp(state.du);
+
+        set_constant(derivative.ddu_at_baryctr, 0);
     });
 }
 
 template <typename ProblemDiscretizationType>
 void compute_ddu_avg(ProblemDiscretizationType& discretization, const ESSPRKStepper& stepper) {
-    discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-        auto& derivative = elt.data.derivative;
-        set_constant(derivative.ddu_at_baryctr, 0);
-    });
-
+    // ddu_at_baryctr is reset in compute_dze_du
     discretization.mesh.CallForEachInterface([&stepper](auto& intface) {
         const uint stage    = stepper.GetStage();
         auto& state_in      = intface.data_in.state[stage];
         auto& state_ex      = intface.data_ex.state[stage];
         auto& derivative_in = intface.data_in.derivative;
         auto& derivative_ex = intface.data_ex.derivative;
+        auto& boundary_in   = intface.data_in.boundary[intface.bound_id_in];
+        auto& boundary_ex   = intface.data_ex.boundary[intface.bound_id_ex];
 
-        const auto du_at_gp_in = intface.ComputeUgpIN(state_in.du);
-        const auto du_at_gp_ex = intface.ComputeUgpEX(state_ex.du);
+        set_ddu_kernel(boundary_in, intface.ComputeUgpIN(state_in.du), intface.surface_normal_in);
+        set_ddu_kernel(boundary_ex, intface.ComputeUgpEX(state_ex.du), intface.surface_normal_ex);
 
-        for (uint du = 0; du < GN::n_du_terms; ++du) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative_in.ddu_at_baryctr, GN::n_dimensions * du + dir) +=
-                    1.0 / derivative_in.area *
-                    intface.IntegrationIN(vec_cw_mult(row(du_at_gp_in, du), row(intface.surface_normal_in, dir)));
-                row(derivative_ex.ddu_at_baryctr, GN::n_dimensions * du + dir) +=
-                    1.0 / derivative_ex.area *
-                    intface.IntegrationEX(vec_cw_mult(row(du_at_gp_ex, du), row(intface.surface_normal_ex, dir)));
-            }
-        }
+        derivative_in.ddu_at_baryctr += 1.0 / derivative_in.area * intface.IntegrationIN(boundary_in.ddu_kernel_at_gp);
+        derivative_ex.ddu_at_baryctr += 1.0 / derivative_ex.area * intface.IntegrationEX(boundary_ex.ddu_kernel_at_gp);
     });
 
     discretization.mesh.CallForEachBoundary([&stepper](auto& bound) {
         const uint stage = stepper.GetStage();
         auto& state      = bound.data.state[stage];
         auto& derivative = bound.data.derivative;
+        auto& boundary   = bound.data.boundary[bound.bound_id];
 
-        const auto du_at_gp = bound.ComputeUgp(state.du);
+        set_ddu_kernel(boundary, bound.ComputeUgp(state.du), bound.surface_normal);
 
-        for (uint du = 0; du < GN::n_du_terms; ++du) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative.ddu_at_baryctr, GN::n_dimensions * du + dir) +=
-                    1.0 / derivative.area *
-                    bound.Integration(vec_cw_mult(row(du_at_gp, du), row(bound.surface_normal, dir)));
-            }
-        }
+        derivative.ddu_at_baryctr += 1.0 / derivative.area * bound.Integration(boundary.ddu_kernel_at_gp);
     });
 
     discretization.mesh.CallForEachDistributedBoundary([&stepper](auto& dbound) {
         const uint stage = stepper.GetStage();
         auto& state      = dbound.data.state[stage];
         auto& derivative = dbound.data.derivative;
+        auto& boundary   = dbound.data.boundary[dbound.bound_id];
 
-        const auto du_at_gp = dbound.ComputeUgp(state.du);
+        set_ddu_kernel(boundary, dbound.ComputeUgp(state.du), dbound.surface_normal);
 
-        for (uint du = 0; du < GN::n_du_terms; ++du) {
-            for (uint dir = 0; dir < GN::n_dimensions; ++dir) {
-                row(derivative.ddu_at_baryctr, GN::n_dimensions * du + dir) +=
-                    1.0 / derivative.area *
-                    dbound.Integration(vec_cw_mult(row(du_at_gp, du), row(dbound.surface_normal, dir)));
-            }
-        }
+        derivative.ddu_at_baryctr += 1.0 / derivative.area * dbound.Integration(boundary.ddu_kernel_at_gp);
     });
 }
 
@@ -340,8 +270,7 @@ void compute_ddu(ProblemDiscretizationType& discretization, const ESSPRKStepper&
 
     discretization.mesh.CallForEachDistributedBoundary([&stepper](auto& dbound) {
         auto& derivative = dbound.data.derivative;
-        std::vector<double> message(n_ddu_terms);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::derivatives, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::derivatives, GN::n_ddu_terms);
         for (uint ddu = 0; ddu < GN::n_ddu_terms; ++ddu) {
             derivative.ddu_at_baryctr_neigh[dbound.bound_id][ddu] = message[ddu];
         }
@@ -27,124 +27,185 @@ void Problem::ompi_solve_global_dc_problem(std::vector<std::unique_ptr<OMPISimUn
             solve_sle(internal.w1_w1, internal.w1_rhs);
         });
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
-            auto& edge_internal = edge_int.edge_data.edge_internal;
+        if (SWE::GlobalProblem::matrix_free) {
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
 
-            auto& internal_in = edge_int.interface.data_in.internal;
-            auto& internal_ex = edge_int.interface.data_ex.internal;
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
 
-            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
-            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-            boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
+                boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
 
-            boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
+                boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
 
-            edge_internal.w1_hat_w1_hat -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
-                                           boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
-                                           boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat +
-                                           boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat;
+                DynMatrix<double> w1_hat_w1_hat_diag =
+                    edge_internal.w1_hat_w1_hat -
+                    (boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
+                     boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
+                     boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat + boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat);
 
-            edge_internal.w1_hat_rhs =
-                -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
+                edge_internal.w1_hat_rhs =
+                    -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
 
-            edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(w1_hat_w1_hat_diag);
+            });
 
-            uint bcon_id = 0;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-            for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-                if (bound_id == edge_int.interface.bound_id_in)
-                    continue;
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-                auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+                DynMatrix<double> w1_hat_w1_hat_diag =
+                    edge_internal.w1_hat_w1_hat - boundary.w1_hat_w1 * boundary.w1_w1_hat;
 
-                edge_internal.w1_hat_w1_hat = -(boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_con.w2_w1_hat +
-                                                boundary_in.w1_hat_w1 * boundary_con.w1_w1_hat);
+                edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
 
-                edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(w1_hat_w1_hat_diag);
+            });
 
-                ++bcon_id;
-            }
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
+                auto& edge_internal = edge_dbound.edge_data.edge_internal;
 
-            for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-                if (bound_id == edge_int.interface.bound_id_ex)
-                    continue;
+                auto& internal = edge_dbound.boundary.data.internal;
+                auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
 
-                auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+                boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1;
 
-                edge_internal.w1_hat_w1_hat = -(boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_con.w2_w1_hat +
-                                                boundary_ex.w1_hat_w1 * boundary_con.w1_w1_hat);
+                DynMatrix<double> w1_hat_w1_hat_diag =
+                    edge_internal.w1_hat_w1_hat - (boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat +
+                                                   boundary.w1_hat_w1 * boundary.w1_w1_hat);
 
-                edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+                edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
 
-                ++bcon_id;
-            }
-        });
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(w1_hat_w1_hat_diag);
+            });
+        } else {
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
-            auto& edge_internal = edge_bound.edge_data.edge_internal;
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
 
-            auto& internal = edge_bound.boundary.data.internal;
-            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-            /* boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1; */
+                boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
 
-            edge_internal.w1_hat_w1_hat -=
-                /* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat + */ boundary.w1_hat_w1 *
-                boundary.w1_w1_hat;
+                boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
 
-            edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
+                edge_internal.w1_hat_w1_hat -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
+                                               boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
+                                               boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat +
+                                               boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat;
 
-            edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
+                edge_internal.w1_hat_rhs =
+                    -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
 
-            uint bcon_id = 0;
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
 
-            for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-                if (bound_id == edge_bound.boundary.bound_id)
-                    continue;
+                uint bcon_id = 0;
 
-                auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+                for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_int.interface.bound_id_in)
+                        continue;
 
-                edge_internal.w1_hat_w1_hat = -(/* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat + */
-                                                boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+                    auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
 
-                edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+                    edge_internal.w1_hat_w1_hat =
+                        -(boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_con.w2_w1_hat +
+                          boundary_in.w1_hat_w1 * boundary_con.w1_w1_hat);
 
-                ++bcon_id;
-            }
-        });
+                    edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
-            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+                    ++bcon_id;
+                }
 
-            auto& internal = edge_dbound.boundary.data.internal;
-            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+                for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_int.interface.bound_id_ex)
+                        continue;
 
-            boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1;
+                    auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-            edge_internal.w1_hat_w1_hat -=
-                boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat + boundary.w1_hat_w1 * boundary.w1_w1_hat;
+                    edge_internal.w1_hat_w1_hat =
+                        -(boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_con.w2_w1_hat +
+                          boundary_ex.w1_hat_w1 * boundary_con.w1_w1_hat);
 
-            edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
+                    edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
 
-            edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
+                    ++bcon_id;
+                }
+            });
 
-            uint bcon_id = 0;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-            for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
-                if (bound_id == edge_dbound.boundary.bound_id)
-                    continue;
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-                auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+                /* boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1; */
 
-                edge_internal.w1_hat_w1_hat = -(boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat +
-                                                boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+                edge_internal.w1_hat_w1_hat -=
+                    /* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat + */ boundary.w1_hat_w1 *
+                    boundary.w1_w1_hat;
 
-                edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+                edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
 
-                ++bcon_id;
-            }
-        });
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
+
+                uint bcon_id = 0;
+
+                for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_bound.boundary.bound_id)
+                        continue;
+
+                    auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+
+                    edge_internal.w1_hat_w1_hat =
+                        -(/* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat + */
+                          boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+
+                    edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+
+                    ++bcon_id;
+                }
+            });
+
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
+                auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                auto& internal = edge_dbound.boundary.data.internal;
+                auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1;
+
+                edge_internal.w1_hat_w1_hat -= boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat +
+                                               boundary.w1_hat_w1 * boundary.w1_w1_hat;
+
+                edge_internal.w1_hat_rhs = -boundary.w1_hat_w1 * internal.w1_rhs;
+
+                edge_internal.w1_hat_w1_hat_flat = flatten<double>(edge_internal.w1_hat_w1_hat);
+
+                uint bcon_id = 0;
+
+                for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_dbound.boundary.bound_id)
+                        continue;
+
+                    auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+
+                    edge_internal.w1_hat_w1_hat = -(boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat +
+                                                    boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+
+                    edge_internal.w1_hat_w1_hat_con_flat[bcon_id] = flatten<double>(edge_internal.w1_hat_w1_hat);
+
+                    ++bcon_id;
+                }
+            });
+        }
     }
 
     Mat& w1_hat_w1_hat = global_data.w1_hat_w1_hat;
@@ -153,158 +214,381 @@ void Problem::ompi_solve_global_dc_problem(std::vector<std::unique_ptr<OMPISimUn
 #pragma omp barrier
 #pragma omp master
     {
-        for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
-                [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_int) {
-                    auto& edge_internal = edge_int.edge_data.edge_internal;
+        if (SWE::GlobalProblem::matrix_free) {
+            Mat& w1_hat_w1_hat_precon = global_data.w1_hat_w1_hat_precon;
+
+            // Only diagonal blocks are assembled for block Jacobi preconditioner
+            auto assemble_diag = [&w1_hat_rhs, &w1_hat_w1_hat_precon](auto& edge_internal) {
+                std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                VecSetValues(w1_hat_rhs,
+                             dc_global_dof_indx.size(),
+                             (int*)&dc_global_dof_indx.front(),
+                             edge_internal.w1_hat_rhs.data(),
+                             ADD_VALUES);
+
+                MatSetValues(w1_hat_w1_hat_precon,
+                             dc_global_dof_indx.size(),
+                             (int*)&dc_global_dof_indx.front(),
+                             dc_global_dof_indx.size(),
+                             (int*)&dc_global_dof_indx.front(),
+                             edge_internal.w1_hat_w1_hat_flat.data(),
+                             ADD_VALUES);
+            };
+
+            for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                    [&assemble_diag](auto& edge_int) { assemble_diag(edge_int.edge_data.edge_internal); });
+
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                    [&assemble_diag](auto& edge_bound) { assemble_diag(edge_bound.edge_data.edge_internal); });
+
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                    [&assemble_diag](auto& edge_dbound) { assemble_diag(edge_dbound.edge_data.edge_internal); });
+            }
 
-                    std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+            MatAssemblyBegin(w1_hat_w1_hat_precon, MAT_FINAL_ASSEMBLY);
+            MatAssemblyEnd(w1_hat_w1_hat_precon, MAT_FINAL_ASSEMBLY);
 
-                    VecSetValues(w1_hat_rhs,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_rhs.data(),
-                                 ADD_VALUES);
+            VecAssemblyBegin(w1_hat_rhs);
+            VecAssemblyEnd(w1_hat_rhs);
 
-                    MatSetValues(w1_hat_w1_hat,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_w1_hat_flat.data(),
-                                 ADD_VALUES);
+            global_data.w1_hat_w1_hat_apply = [&sim_units, &global_data](Vec w1_hat_global,
+                                                                        Vec w1_hat_w1_hat_w1_hat_global) {
+                VecScatter& dc_scatter = global_data.dc_scatter;
+                Vec& dc_sol            = global_data.dc_sol;
 
-                    uint bcon_id = 0;
+                VecScatterBegin(dc_scatter, w1_hat_global, dc_sol, INSERT_VALUES, SCATTER_FORWARD);
 
-                    for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_int.interface.bound_id_in)
-                            continue;
+                // Interface and boundary edge dofs are owned by this locality,
+                // their contributions are accumulated while the scatter is in flight
+                const double* w1_hat_ptr;
+                VecGetArrayRead(w1_hat_global, &w1_hat_ptr);
 
-                        auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+                int owned_begin, owned_size;
+                VecGetOwnershipRange(w1_hat_global, &owned_begin, nullptr);
+                VecGetLocalSize(w1_hat_global, &owned_size);
 
-                        std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+                auto w1_hat_owned = vector_from_array(const_cast<double*>(w1_hat_ptr), owned_size);
 
-                        MatSetValues(w1_hat_w1_hat,
-                                     dc_global_dof_indx.size(),
-                                     (int*)&dc_global_dof_indx.front(),
-                                     dc_global_dof_con_indx.size(),
-                                     (int*)&dc_global_dof_con_indx.front(),
-                                     edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
-                                     ADD_VALUES);
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
+                        set_constant(elt.data.internal.w1_local, 0.0);
+                        set_constant(elt.data.internal.w2_local, 0.0);
+                    });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                        [&w1_hat_owned, owned_begin](auto& edge_int) {
+                            auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                            auto& internal_in = edge_int.interface.data_in.internal;
+                            auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                            auto w1_hat = subvector(w1_hat_owned,
+                                                    (uint)(dc_global_dof_indx[0] - owned_begin),
+                                                    (uint)dc_global_dof_indx.size());
+
+                            internal_in.w1_local += boundary_in.w1_w1_hat * w1_hat;
+                            internal_in.w2_local += boundary_in.w2_w1_hat * w1_hat;
+
+                            internal_ex.w1_local += boundary_ex.w1_w1_hat * w1_hat;
+                            internal_ex.w2_local += boundary_ex.w2_w1_hat * w1_hat;
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                        [&w1_hat_owned, owned_begin](auto& edge_bound) {
+                            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                            auto& internal = edge_bound.boundary.data.internal;
+                            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                            auto w1_hat = subvector(w1_hat_owned,
+                                                    (uint)(dc_global_dof_indx[0] - owned_begin),
+                                                    (uint)dc_global_dof_indx.size());
+
+                            internal.w1_local += boundary.w1_w1_hat * w1_hat;
+                            internal.w2_local += boundary.w2_w1_hat * w1_hat;
+                        });
+                }
+
+                VecRestoreArrayRead(w1_hat_global, &w1_hat_ptr);
 
-                        ++bcon_id;
-                    }
+                VecScatterEnd(dc_scatter, w1_hat_global, dc_sol, INSERT_VALUES, SCATTER_FORWARD);
 
-                    for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_int.interface.bound_id_ex)
-                            continue;
+                double* sol_ptr;
+                VecGetArray(dc_sol, &sol_ptr);
 
-                        auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+                int sol_size;
+                VecGetLocalSize(dc_sol, &sol_size);
 
-                        std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+                global_data.dc_solution = vector_from_array(sol_ptr, sol_size);
+
+                VecRestoreArray(dc_sol, &sol_ptr);
+
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                        [&global_data](auto& edge_dbound) {
+                            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                            auto& internal = edge_dbound.boundary.data.internal;
+                            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                            uint n_global_dofs = edge_internal.dc_global_dof_indx.size();
+
+                            auto w1_hat =
+                                subvector(global_data.dc_solution, edge_internal.dc_sol_offset, n_global_dofs);
+
+                            internal.w1_local += boundary.w1_w1_hat * w1_hat;
+                            internal.w2_local += boundary.w2_w1_hat * w1_hat;
+                        });
+
+                    sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
+                        auto& internal = elt.data.internal;
+
+                        internal.w2_local = internal.w2_w2_inv * internal.w2_local;
+                    });
+                }
+
+                VecZeroEntries(w1_hat_w1_hat_w1_hat_global);
+
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                        [&global_data, &w1_hat_w1_hat_w1_hat_global](auto& edge_int) {
+                            auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                            auto& internal_in = edge_int.interface.data_in.internal;
+                            auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                            DynVector<double> w1_hat_w1_hat_w1_hat =
+                                edge_internal.w1_hat_w1_hat * subvector(global_data.dc_solution,
+                                                                        edge_internal.dc_sol_offset,
+                                                                        dc_global_dof_indx.size()) -
+                                (boundary_in.w1_hat_w2 * internal_in.w2_local +
+                                 boundary_ex.w1_hat_w2 * internal_ex.w2_local +
+                                 boundary_in.w1_hat_w1 * internal_in.w1_local +
+                                 boundary_ex.w1_hat_w1 * internal_ex.w1_local);
+
+                            VecSetValues(w1_hat_w1_hat_w1_hat_global,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         w1_hat_w1_hat_w1_hat.data(),
+                                         ADD_VALUES);
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                        [&global_data, &w1_hat_w1_hat_w1_hat_global](auto& edge_bound) {
+                            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                            auto& internal = edge_bound.boundary.data.internal;
+                            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                            DynVector<double> w1_hat_w1_hat_w1_hat =
+                                edge_internal.w1_hat_w1_hat * subvector(global_data.dc_solution,
+                                                                        edge_internal.dc_sol_offset,
+                                                                        dc_global_dof_indx.size()) -
+                                boundary.w1_hat_w1 * internal.w1_local;
+
+                            VecSetValues(w1_hat_w1_hat_w1_hat_global,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         w1_hat_w1_hat_w1_hat.data(),
+                                         ADD_VALUES);
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                        [&global_data, &w1_hat_w1_hat_w1_hat_global](auto& edge_dbound) {
+                            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                            auto& internal = edge_dbound.boundary.data.internal;
+                            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                            DynVector<double> w1_hat_w1_hat_w1_hat =
+                                edge_internal.w1_hat_w1_hat * subvector(global_data.dc_solution,
+                                                                        edge_internal.dc_sol_offset,
+                                                                        dc_global_dof_indx.size()) -
+                                (boundary.w1_hat_w2 * internal.w2_local + boundary.w1_hat_w1 * internal.w1_local);
+
+                            VecSetValues(w1_hat_w1_hat_w1_hat_global,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         w1_hat_w1_hat_w1_hat.data(),
+                                         ADD_VALUES);
+                        });
+                }
+
+                VecAssemblyBegin(w1_hat_w1_hat_w1_hat_global);
+                VecAssemblyEnd(w1_hat_w1_hat_w1_hat_global);
+            };
+        } else {
+            for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                    [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_int) {
+                        auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                        std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                        VecSetValues(w1_hat_rhs,
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_rhs.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(w1_hat_w1_hat,
                                      dc_global_dof_indx.size(),
                                      (int*)&dc_global_dof_indx.front(),
-                                     dc_global_dof_con_indx.size(),
-                                     (int*)&dc_global_dof_con_indx.front(),
-                                     edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_w1_hat_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
+                        uint bcon_id = 0;
+
+                        for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_int.interface.bound_id_in)
+                                continue;
+
+                            auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+
+                            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+
+                            MatSetValues(w1_hat_w1_hat,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         dc_global_dof_con_indx.size(),
+                                         (int*)&dc_global_dof_con_indx.front(),
+                                         edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
+
+                            ++bcon_id;
+                        }
 
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
-                [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_bound) {
-                    auto& edge_internal = edge_bound.edge_data.edge_internal;
+                        for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_int.interface.bound_id_ex)
+                                continue;
 
-                    std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+                            auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-                    VecSetValues(w1_hat_rhs,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_rhs.data(),
-                                 ADD_VALUES);
+                            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
 
-                    MatSetValues(w1_hat_w1_hat,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_w1_hat_flat.data(),
-                                 ADD_VALUES);
+                            MatSetValues(w1_hat_w1_hat,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         dc_global_dof_con_indx.size(),
+                                         (int*)&dc_global_dof_con_indx.front(),
+                                         edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
 
-                    uint bcon_id = 0;
+                            ++bcon_id;
+                        }
+                    });
 
-                    for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_bound.boundary.bound_id)
-                            continue;
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                    [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_bound) {
+                        auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-                        auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+                        std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-                        std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+                        VecSetValues(w1_hat_rhs,
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_rhs.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(w1_hat_w1_hat,
                                      dc_global_dof_indx.size(),
                                      (int*)&dc_global_dof_indx.front(),
-                                     dc_global_dof_con_indx.size(),
-                                     (int*)&dc_global_dof_con_indx.front(),
-                                     edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_w1_hat_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
+                        uint bcon_id = 0;
 
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
-                [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_dbound) {
-                    auto& edge_internal = edge_dbound.edge_data.edge_internal;
+                        for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_bound.boundary.bound_id)
+                                continue;
 
-                    std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+                            auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
 
-                    VecSetValues(w1_hat_rhs,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_rhs.data(),
-                                 ADD_VALUES);
+                            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
 
-                    MatSetValues(w1_hat_w1_hat,
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 dc_global_dof_indx.size(),
-                                 (int*)&dc_global_dof_indx.front(),
-                                 edge_internal.w1_hat_w1_hat_flat.data(),
-                                 ADD_VALUES);
+                            MatSetValues(w1_hat_w1_hat,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         dc_global_dof_con_indx.size(),
+                                         (int*)&dc_global_dof_con_indx.front(),
+                                         edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
 
-                    uint bcon_id = 0;
+                            ++bcon_id;
+                        }
+                    });
 
-                    for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_dbound.boundary.bound_id)
-                            continue;
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                    [&w1_hat_rhs, &w1_hat_w1_hat](auto& edge_dbound) {
+                        auto& edge_internal = edge_dbound.edge_data.edge_internal;
 
-                        auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+                        std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-                        std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+                        VecSetValues(w1_hat_rhs,
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_rhs.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(w1_hat_w1_hat,
                                      dc_global_dof_indx.size(),
                                      (int*)&dc_global_dof_indx.front(),
-                                     dc_global_dof_con_indx.size(),
-                                     (int*)&dc_global_dof_con_indx.front(),
-                                     edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                     dc_global_dof_indx.size(),
+                                     (int*)&dc_global_dof_indx.front(),
+                                     edge_internal.w1_hat_w1_hat_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
-        }
+                        uint bcon_id = 0;
 
-        MatAssemblyBegin(w1_hat_w1_hat, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(w1_hat_w1_hat, MAT_FINAL_ASSEMBLY);
+                        for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_dbound.boundary.bound_id)
+                                continue;
 
-        VecAssemblyBegin(w1_hat_rhs);
-        VecAssemblyEnd(w1_hat_rhs);
+                            auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+
+                            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+
+                            MatSetValues(w1_hat_w1_hat,
+                                         dc_global_dof_indx.size(),
+                                         (int*)&dc_global_dof_indx.front(),
+                                         dc_global_dof_con_indx.size(),
+                                         (int*)&dc_global_dof_con_indx.front(),
+                                         edge_internal.w1_hat_w1_hat_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
+
+                            ++bcon_id;
+                        }
+                    });
+            }
+
+            MatAssemblyBegin(w1_hat_w1_hat, MAT_FINAL_ASSEMBLY);
+            MatAssemblyEnd(w1_hat_w1_hat, MAT_FINAL_ASSEMBLY);
+
+            VecAssemblyBegin(w1_hat_rhs);
+            VecAssemblyEnd(w1_hat_rhs);
+        }
 
         KSP& dc_ksp            = global_data.dc_ksp;
         Vec& dc_sol            = global_data.dc_sol;
@@ -325,7 +609,12 @@ void Problem::ompi_solve_global_dc_problem(std::vector<std::unique_ptr<OMPISimUn
 
         VecRestoreArray(dc_sol, &sol_ptr);
 
-        MatZeroEntries(w1_hat_w1_hat);
+        if (SWE::GlobalProblem::matrix_free) {
+            MatZeroEntries(global_data.w1_hat_w1_hat_precon);
+        } else {
+            MatZeroEntries(w1_hat_w1_hat);
+        }
+
         VecZeroEntries(w1_hat_rhs);
     }
 #pragma omp barrier
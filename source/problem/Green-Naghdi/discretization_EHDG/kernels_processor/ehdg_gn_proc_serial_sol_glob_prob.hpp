@@ -1,6 +1,8 @@
 #ifndef EHDG_GN_PROC_SERIAL_SOL_GLOB_PROB_HPP
 #define EHDG_GN_PROC_SERIAL_SOL_GLOB_PROB_HPP
 
+#include "utilities/linear_algebra/gmres.hpp"
+
 namespace GN {
 namespace EHDG {
 void Problem::serial_solve_global_dc_problem(ProblemDiscretizationType& discretization,
@@ -28,122 +30,259 @@ void Problem::serial_solve_global_dc_problem(ProblemDiscretizationType& discreti
         solve_sle(internal.w1_w1, internal.w1_rhs);
     });
 
-    discretization.mesh_skeleton.CallForEachEdgeInterface([&w1_hat_rhs, &sparse_w1_hat_w1_hat](auto& edge_int) {
-        auto& edge_internal = edge_int.edge_data.edge_internal;
+    if (SWE::GlobalProblem::matrix_free) {
+        // Condense rhs and store inverses of condensed diagonal blocks for block Jacobi preconditioner,
+        // off-diagonal blocks are never formed
+        discretization.mesh_skeleton.CallForEachEdgeInterface([&w1_hat_rhs](auto& edge_int) {
+            auto& edge_internal = edge_int.edge_data.edge_internal;
 
-        auto& internal_in = edge_int.interface.data_in.internal;
-        auto& internal_ex = edge_int.interface.data_ex.internal;
+            auto& internal_in = edge_int.interface.data_in.internal;
+            auto& internal_ex = edge_int.interface.data_ex.internal;
 
-        auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
-        auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-        std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-        boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
+            boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
 
-        boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
+            boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
 
-        edge_internal.w1_hat_w1_hat -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
-                                       boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
-                                       boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat +
-                                       boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat;
+            DynMatrix<double> w1_hat_w1_hat_diag =
+                edge_internal.w1_hat_w1_hat - (boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
+                                               boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
+                                               boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat +
+                                               boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat);
 
-        subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
-            -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
+            edge_internal.w1_hat_w1_hat_inv = inverse(w1_hat_w1_hat_diag);
 
-        for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
-            for (uint j = 0; j < dc_global_dof_indx.size(); ++j) {
-                sparse_w1_hat_w1_hat.add_triplet(
-                    dc_global_dof_indx[i], dc_global_dof_indx[j], edge_internal.w1_hat_w1_hat(i, j));
-            }
-        }
+            subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
+        });
 
-        for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-            if (bound_id == edge_int.interface.bound_id_in)
-                continue;
+        discretization.mesh_skeleton.CallForEachEdgeBoundary([&w1_hat_rhs](auto& edge_bound) {
+            auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-            auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+            auto& internal = edge_bound.boundary.data.internal;
+            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-            edge_internal.w1_hat_w1_hat = -(boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_con.w2_w1_hat +
-                                            boundary_in.w1_hat_w1 * boundary_con.w1_w1_hat);
+            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+            DynMatrix<double> w1_hat_w1_hat_diag =
+                edge_internal.w1_hat_w1_hat - boundary.w1_hat_w1 * boundary.w1_w1_hat;
 
-            for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
-                    sparse_w1_hat_w1_hat.add_triplet(
-                        dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+            edge_internal.w1_hat_w1_hat_inv = inverse(w1_hat_w1_hat_diag);
+
+            subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                -boundary.w1_hat_w1 * internal.w1_rhs;
+        });
+
+        auto apply_w1_hat_w1_hat = [&discretization](const DynVector<double>& w1_hat,
+                                                     DynVector<double>& w1_hat_w1_hat_w1_hat) {
+            discretization.mesh.CallForEachElement([&w1_hat](auto& elt) {
+                auto& internal = elt.data.internal;
+
+                set_constant(internal.w1_local, 0.0);
+                set_constant(internal.w2_local, 0.0);
+
+                for (uint bound_id = 0; bound_id < elt.data.get_nbound(); ++bound_id) {
+                    auto& boundary = elt.data.boundary[bound_id];
+
+                    std::vector<uint>& dc_global_dof_indx = boundary.dc_global_dof_indx;
+
+                    auto w1_hat_bound = subvector(w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size());
+
+                    internal.w1_local += boundary.w1_w1_hat * w1_hat_bound;
+                    internal.w2_local += boundary.w2_w1_hat * w1_hat_bound;
                 }
-            }
+
+                internal.w2_local = internal.w2_w2_inv * internal.w2_local;
+            });
+
+            discretization.mesh_skeleton.CallForEachEdgeInterface([&w1_hat, &w1_hat_w1_hat_w1_hat](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                subvector(w1_hat_w1_hat_w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                    edge_internal.w1_hat_w1_hat *
+                        subvector(w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) -
+                    (boundary_in.w1_hat_w2 * internal_in.w2_local + boundary_ex.w1_hat_w2 * internal_ex.w2_local +
+                     boundary_in.w1_hat_w1 * internal_in.w1_local + boundary_ex.w1_hat_w1 * internal_ex.w1_local);
+            });
+
+            discretization.mesh_skeleton.CallForEachEdgeBoundary([&w1_hat, &w1_hat_w1_hat_w1_hat](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                subvector(w1_hat_w1_hat_w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                    edge_internal.w1_hat_w1_hat *
+                        subvector(w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) -
+                    boundary.w1_hat_w1 * internal.w1_local;
+            });
+        };
+
+        auto apply_block_jacobi = [&discretization](const DynVector<double>& w1_hat,
+                                                    DynVector<double>& precon_w1_hat) {
+            auto apply_block_inv = [&w1_hat, &precon_w1_hat](auto& edge_internal) {
+                std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+                subvector(precon_w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                    edge_internal.w1_hat_w1_hat_inv *
+                    subvector(w1_hat, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size());
+            };
+
+            discretization.mesh_skeleton.CallForEachEdgeInterface(
+                [&apply_block_inv](auto& edge_int) { apply_block_inv(edge_int.edge_data.edge_internal); });
+
+            discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                [&apply_block_inv](auto& edge_bound) { apply_block_inv(edge_bound.edge_data.edge_internal); });
+        };
+
+        DynVector<double> w1_hat = w1_hat_rhs;
+        set_constant(w1_hat, 0.0);
+
+        const uint n_iterations = solve_gmres<double>(apply_w1_hat_w1_hat,
+                                                      apply_block_jacobi,
+                                                      w1_hat_rhs,
+                                                      w1_hat,
+                                                      SWE::GlobalProblem::tolerance,
+                                                      SWE::GlobalProblem::max_iterations,
+                                                      SWE::GlobalProblem::restart);
+
+        if (n_iterations == SWE::GlobalProblem::max_iterations) {
+            std::cerr << "Warning: matrix-free global solver reached maximum number of iterations.\n";
         }
 
-        for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-            if (bound_id == edge_int.interface.bound_id_ex)
-                continue;
+        w1_hat_rhs = w1_hat;
+    } else {
+        discretization.mesh_skeleton.CallForEachEdgeInterface([&w1_hat_rhs, &sparse_w1_hat_w1_hat](auto& edge_int) {
+            auto& edge_internal = edge_int.edge_data.edge_internal;
+
+            auto& internal_in = edge_int.interface.data_in.internal;
+            auto& internal_ex = edge_int.interface.data_ex.internal;
+
+            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+
+            boundary_in.w1_hat_w1 -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * internal_in.w2_w1;
 
-            auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+            boundary_ex.w1_hat_w1 -= boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * internal_ex.w2_w1;
 
-            edge_internal.w1_hat_w1_hat = -(boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_con.w2_w1_hat +
-                                            boundary_ex.w1_hat_w1 * boundary_con.w1_w1_hat);
+            edge_internal.w1_hat_w1_hat -= boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_in.w2_w1_hat +
+                                           boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_ex.w2_w1_hat +
+                                           boundary_in.w1_hat_w1 * boundary_in.w1_w1_hat +
+                                           boundary_ex.w1_hat_w1 * boundary_ex.w1_w1_hat;
 
-            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+            subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                -(boundary_in.w1_hat_w1 * internal_in.w1_rhs + boundary_ex.w1_hat_w1 * internal_ex.w1_rhs);
 
             for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
+                for (uint j = 0; j < dc_global_dof_indx.size(); ++j) {
                     sparse_w1_hat_w1_hat.add_triplet(
-                        dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                        dc_global_dof_indx[i], dc_global_dof_indx[j], edge_internal.w1_hat_w1_hat(i, j));
                 }
             }
-        }
-    });
 
-    discretization.mesh_skeleton.CallForEachEdgeBoundary([&w1_hat_rhs, &sparse_w1_hat_w1_hat](auto& edge_bound) {
-        auto& edge_internal = edge_bound.edge_data.edge_internal;
+            for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                if (bound_id == edge_int.interface.bound_id_in)
+                    continue;
+
+                auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+
+                edge_internal.w1_hat_w1_hat = -(boundary_in.w1_hat_w2 * internal_in.w2_w2_inv * boundary_con.w2_w1_hat +
+                                                boundary_in.w1_hat_w1 * boundary_con.w1_w1_hat);
 
-        auto& internal = edge_bound.boundary.data.internal;
-        auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+                std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+
+                for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
+                        sparse_w1_hat_w1_hat.add_triplet(
+                            dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                    }
+                }
+            }
 
-        std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
+            for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                if (bound_id == edge_int.interface.bound_id_ex)
+                    continue;
 
-        /* boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1; */
+                auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-        edge_internal.w1_hat_w1_hat -=
-            /* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat + */ boundary.w1_hat_w1 *
-            boundary.w1_w1_hat;
+                edge_internal.w1_hat_w1_hat = -(boundary_ex.w1_hat_w2 * internal_ex.w2_w2_inv * boundary_con.w2_w1_hat +
+                                                boundary_ex.w1_hat_w1 * boundary_con.w1_w1_hat);
 
-        subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
-            -boundary.w1_hat_w1 * internal.w1_rhs;
+                std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
 
-        for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
-            for (uint j = 0; j < dc_global_dof_indx.size(); ++j) {
-                sparse_w1_hat_w1_hat.add_triplet(
-                    dc_global_dof_indx[i], dc_global_dof_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
+                        sparse_w1_hat_w1_hat.add_triplet(
+                            dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                    }
+                }
             }
-        }
+        });
+
+        discretization.mesh_skeleton.CallForEachEdgeBoundary([&w1_hat_rhs, &sparse_w1_hat_w1_hat](auto& edge_bound) {
+            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+            auto& internal = edge_bound.boundary.data.internal;
+            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-        for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-            if (bound_id == edge_bound.boundary.bound_id)
-                continue;
+            std::vector<uint>& dc_global_dof_indx = edge_internal.dc_global_dof_indx;
 
-            auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+            /* boundary.w1_hat_w1 -= boundary.w1_hat_w2 * internal.w2_w2_inv * internal.w2_w1; */
 
-            edge_internal.w1_hat_w1_hat = -(/* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat + */
-                                            boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+            edge_internal.w1_hat_w1_hat -=
+                /* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary.w2_w1_hat + */ boundary.w1_hat_w1 *
+                boundary.w1_w1_hat;
 
-            std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+            subvector(w1_hat_rhs, (uint)dc_global_dof_indx[0], (uint)dc_global_dof_indx.size()) =
+                -boundary.w1_hat_w1 * internal.w1_rhs;
 
             for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
+                for (uint j = 0; j < dc_global_dof_indx.size(); ++j) {
                     sparse_w1_hat_w1_hat.add_triplet(
-                        dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                        dc_global_dof_indx[i], dc_global_dof_indx[j], edge_internal.w1_hat_w1_hat(i, j));
                 }
             }
-        }
-    });
 
-    sparse_w1_hat_w1_hat.get_sparse_matrix(w1_hat_w1_hat);
+            for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                if (bound_id == edge_bound.boundary.bound_id)
+                    continue;
+
+                auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+
+                edge_internal.w1_hat_w1_hat = -(/* boundary.w1_hat_w2 * internal.w2_w2_inv * boundary_con.w2_w1_hat + */
+                                                boundary.w1_hat_w1 * boundary_con.w1_w1_hat);
+
+                std::vector<uint>& dc_global_dof_con_indx = boundary_con.dc_global_dof_indx;
+
+                for (uint i = 0; i < dc_global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < dc_global_dof_con_indx.size(); ++j) {
+                        sparse_w1_hat_w1_hat.add_triplet(
+                            dc_global_dof_indx[i], dc_global_dof_con_indx[j], edge_internal.w1_hat_w1_hat(i, j));
+                    }
+                }
+            }
+        });
+
+        sparse_w1_hat_w1_hat.get_sparse_matrix(w1_hat_w1_hat);
 
-    solve_sle(w1_hat_w1_hat, w1_hat_rhs);
+        solve_sle(w1_hat_w1_hat, w1_hat_rhs);
+    }
 
     discretization.mesh.CallForEachElement([&w1_hat_rhs, &stepper](auto& elt) {
         const uint stage = stepper.GetStage();
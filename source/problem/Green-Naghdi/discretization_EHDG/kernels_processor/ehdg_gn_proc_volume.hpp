@@ -14,36 +14,16 @@ void Problem::local_dc_volume_kernel(const ESSPRKStepper& stepper, ElementType&
     const auto bx = row(internal.dbath_at_gp, GlobalCoord::x);
     const auto by = row(internal.dbath_at_gp, GlobalCoord::y);
 
-    set_constant(internal.w1_w1_kernel_at_gp, 0.0);
-    set_constant(row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xx), 1.0);
-    set_constant(row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yy), 1.0);
-    row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xx) += NDParameters::alpha * vec_cw_mult(bx, bx);
-    row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::xy) += NDParameters::alpha * vec_cw_mult(bx, by);
-    row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yx) += NDParameters::alpha * vec_cw_mult(by, bx);
-    row(internal.w1_w1_kernel_at_gp, RowMajTrans2D::yy) += NDParameters::alpha * vec_cw_mult(by, by);
+    // time-invariant parts of w1_w1 and w1_w2 are precomputed in preprocessor
+    internal.w1_w1 = internal.w1_w1_static;
+    internal.w1_w2 = internal.w1_w2_static;
 
-    set_constant(internal.w1_w2_kernel_at_gp, -NDParameters::alpha / 3.0);
     row(internal.w2_w1_kernel_at_gp, GlobalCoord::x) = power(h, -1.0);
     row(internal.w2_w1_kernel_at_gp, GlobalCoord::y) = power(h, -1.0);
     internal.w2_w2_kernel_at_gp                      = power(h, -3.0);
 
     for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
         for (uint dof_j = 0; dof_j < elt.data.get_ndof(); ++dof_j) {
-            internal.w1_w2(GN::n_dimensions * dof_i + GlobalCoord::x, dof_j) =
-                elt.IntegrationPhiDPhi(dof_i, GlobalCoord::x, dof_j, row(internal.w1_w2_kernel_at_gp, GlobalCoord::x));
-            internal.w1_w2(GN::n_dimensions * dof_i + GlobalCoord::y, dof_j) =
-                elt.IntegrationPhiDPhi(dof_i, GlobalCoord::y, dof_j, row(internal.w1_w2_kernel_at_gp, GlobalCoord::y));
-        }
-    }
-
-    for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
-        for (uint dof_j = 0; dof_j < elt.data.get_ndof(); ++dof_j) {
-            submatrix(internal.w1_w1,
-                      GN::n_dimensions * dof_i,
-                      GN::n_dimensions * dof_j,
-                      GN::n_dimensions,
-                      GN::n_dimensions) =
-                reshape<double, GN::n_dimensions>(elt.IntegrationPhiPhi(dof_i, dof_j, internal.w1_w1_kernel_at_gp));
             internal.w2_w1(dof_i, GN::n_dimensions * dof_j + GlobalCoord::x) =
                 elt.IntegrationPhiDPhi(dof_j, GlobalCoord::x, dof_i, row(internal.w2_w1_kernel_at_gp, GlobalCoord::x));
             internal.w2_w1(dof_i, GN::n_dimensions * dof_j + GlobalCoord::y) =
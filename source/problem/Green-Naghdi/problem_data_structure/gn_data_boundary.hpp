@@ -7,6 +7,8 @@ struct Boundary : SWE::Boundary {
     Boundary(const uint ngp)
         : SWE::Boundary(ngp),
           dbath_hat_at_gp(GN::n_dimensions, ngp),
+          dze_du_kernel_at_gp(GN::n_dimensions + GN::n_du_terms, ngp),
+          ddu_kernel_at_gp(GN::n_ddu_terms, ngp),
           w1_w1_kernel_at_gp(GN::n_dimensions * GN::n_dimensions, ngp),
           w1_w1_hat_kernel_at_gp(GN::n_dimensions * GN::n_dimensions, ngp),
           w2_w1_hat_kernel_at_gp(GN::n_dimensions, ngp),
@@ -15,6 +17,9 @@ struct Boundary : SWE::Boundary {
 
     HybMatrix<double, GN::n_dimensions> dbath_hat_at_gp;
 
+    HybMatrix<double, GN::n_dimensions + GN::n_du_terms> dze_du_kernel_at_gp;
+    HybMatrix<double, GN::n_ddu_terms> ddu_kernel_at_gp;
+
     HybMatrix<double, GN::n_dimensions * GN::n_dimensions> w1_w1_kernel_at_gp;
 
     HybMatrix<double, GN::n_dimensions * GN::n_dimensions> w1_w1_hat_kernel_at_gp;
@@ -23,6 +28,9 @@ struct Boundary : SWE::Boundary {
     HybMatrix<double, GN::n_dimensions * GN::n_dimensions> w1_hat_w1_kernel_at_gp;
     HybMatrix<double, GN::n_dimensions> w1_hat_w2_kernel_at_gp;
 
+    DynMatrix<double> w1_w1_hat_static;
+    DynMatrix<double> w1_hat_w1_static;
+
     DynMatrix<double> w1_w1_hat;
     DynMatrix<double> w2_w1_hat;
 
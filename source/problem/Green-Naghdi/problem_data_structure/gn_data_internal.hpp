@@ -31,6 +31,9 @@ struct Internal : SWE::Internal {
     HybMatrix<double, GN::n_dimensions> w2_w1_kernel_at_gp;
     DynRowVector<double> w2_w2_kernel_at_gp;
 
+    DynMatrix<double> w1_w1_static;
+    DynMatrix<double> w1_w2_static;
+
     DynMatrix<double> w1_w1;
     DynMatrix<double> w1_w2;
     DynVector<double> w1_rhs;
@@ -39,6 +42,9 @@ struct Internal : SWE::Internal {
     DynMatrix<double> w2_w2;
     DynMatrix<double> w2_w2_inv;
     /* rhs_w2 = 0 */
+
+    DynVector<double> w1_local;
+    DynVector<double> w2_local;
 };
 }
 
@@ -9,9 +9,13 @@ struct EdgeInternal : SWE::EdgeInternal {
 
     HybMatrix<double, GN::n_dimensions * GN::n_dimensions> w1_hat_w1_hat_kernel_at_gp;
 
+    DynMatrix<double> w1_hat_w1_hat_static;
+
     DynMatrix<double> w1_hat_w1_hat;
     DynVector<double> w1_hat_rhs;
 
+    DynMatrix<double> w1_hat_w1_hat_inv;
+
     DynVector<double> w1_hat_w1_hat_flat;
     std::vector<DynVector<double>> w1_hat_w1_hat_con_flat;
 
@@ -20,8 +20,13 @@ struct GlobalData : SWE::GlobalData {
 
     DynVector<double> dc_solution;
 
+    // matrix-free dispersive correction global problem
+    Mat w1_hat_w1_hat_precon = nullptr;
+    std::function<void(Vec, Vec)> w1_hat_w1_hat_apply;
+
     void destroy() {
         MatDestroy(&w1_hat_w1_hat);
+        MatDestroy(&w1_hat_w1_hat_precon);
         VecDestroy(&w1_hat_rhs);
         KSPDestroy(&dc_ksp);
 
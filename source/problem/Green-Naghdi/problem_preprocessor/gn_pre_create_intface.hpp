@@ -2,8 +2,8 @@
 #define GN_PRE_CREATE_INTFACE_HPP
 
 namespace GN {
-template <typename ProblemType, typename RawBoundaryType>
-void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+template <typename ProblemType, typename RawBoundaryTableType>
+void create_interfaces(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                        typename ProblemType::ProblemMeshType& mesh,
                        typename ProblemType::ProblemInputType& problem_input,
                        typename ProblemType::ProblemWriterType& writer) {
@@ -15,21 +15,27 @@ void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
         if (it->first == GN::BoundaryTypes::internal) {
             uint n_intface_old_internal = mesh.GetNumberInterfaces();
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
+            for (auto itt = it->second.begin(); itt != it->second.end(); ++itt) {
+                // an interface is created once, from the side of the element with the lower ID
+                if (itt->first.first > itt->first.second) {
+                    continue;
+                }
+
                 std::pair<uint, uint> key_pre_int_ex = std::pair<uint, uint>{itt->first.second, itt->first.first};
 
-                if (it->second.find(key_pre_int_ex) != it->second.end()) {
+                auto itt_ex = it->second.find(key_pre_int_ex);
+
+                if (itt_ex != it->second.end()) {
                     auto& raw_boundary_in = itt->second;
-                    auto& raw_boundary_ex = it->second.find(key_pre_int_ex)->second;
+                    auto& raw_boundary_ex = itt_ex->second;
 
                     mesh.template CreateInterface<InterfaceTypeInternal>(std::move(raw_boundary_in),
                                                                          std::move(raw_boundary_ex));
                 }
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of internal interfaces: "
                                     << mesh.GetNumberInterfaces() - n_intface_old_internal << std::endl;
@@ -39,13 +45,18 @@ void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
             auto& levee_data = problem_input.levee_is_data;
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
+            for (auto itt = it->second.begin(); itt != it->second.end(); ++itt) {
+                if (itt->first.first > itt->first.second) {
+                    continue;
+                }
+
                 std::pair<uint, uint> key_pre_int_ex = std::pair<uint, uint>{itt->first.second, itt->first.first};
 
-                if (it->second.find(key_pre_int_ex) != it->second.end()) {
+                auto itt_ex = it->second.find(key_pre_int_ex);
+
+                if (itt_ex != it->second.end()) {
                     auto& raw_boundary_in = itt->second;
-                    auto& raw_boundary_ex = it->second.find(key_pre_int_ex)->second;
+                    auto& raw_boundary_ex = itt_ex->second;
 
                     std::vector<SWE::LeveeInput> levee;
 
@@ -70,10 +81,10 @@ void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
                     mesh.template CreateInterface<InterfaceTypeLevee>(
                         std::move(raw_boundary_in), std::move(raw_boundary_ex), levee);
                 }
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of levee interfaces: "
                                     << mesh.GetNumberInterfaces() - n_intface_old_levee << std::endl;
@@ -60,11 +60,10 @@ void initialize_data_parallel_pre_send(MeshType& mesh, uint comm_type) {
     mesh.CallForEachDistributedBoundary([comm_type](auto& dbound) {
         auto& derivative = dbound.data.derivative;
 
-        std::vector<double> message(GN::n_dimensions);
+        auto message = dbound.boundary_condition.exchanger.GetSendMessage(comm_type, GN::n_dimensions);
         for (uint dim = 0; dim < GN::n_dimensions; ++dim) {
             message[dim] = derivative.baryctr_coord[dim];
         }
-        dbound.boundary_condition.exchanger.SetToSendBuffer(comm_type, message);
     });
 }
 
@@ -73,8 +72,7 @@ void initialize_data_parallel_post_receive(MeshType& mesh, uint comm_type) {
     mesh.CallForEachDistributedBoundary([comm_type](auto& dbound) {
         auto& derivative = dbound.data.derivative;
 
-        std::vector<double> message(GN::n_dimensions);
-        dbound.boundary_condition.exchanger.GetFromReceiveBuffer(comm_type, message);
+        auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(comm_type, GN::n_dimensions);
         for (uint dim = 0; dim < GN::n_dimensions; ++dim) {
             derivative.baryctr_coord_neigh[dbound.bound_id][dim] = message[dim];
         }
@@ -40,13 +40,10 @@ template <typename EdgeDistributedType>
 void Distributed::ComputeNumericalFlux(EdgeDistributedType& edge_dbound) {
     /* Get message from ex */
 
-    std::vector<double> message;
-
     uint ngp = edge_dbound.edge_data.get_ngp();
 
-    message.resize(1 + SWE::n_variables * ngp);
-
-    edge_dbound.boundary.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::bound_state, message);
+    auto message = edge_dbound.boundary.boundary_condition.exchanger.GetReceiveMessage(CommTypes::bound_state,
+                                                                                        1 + SWE::n_variables * ngp);
 
     bool wet_ex = (bool)message[0];
 
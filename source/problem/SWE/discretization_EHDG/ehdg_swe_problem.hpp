@@ -97,37 +97,38 @@ struct Problem {
         return offset;
     }
 
-    template <typename RawBoundaryType>
-    static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    // bound_state carries Gauss point traces that tolerate single precision on the wire
+    static std::vector<uint> single_precision_comms() { return {CommTypes::bound_state}; }
+
+    template <typename RawBoundaryTableType>
+    static void create_interfaces(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_interfaces<SWE::EHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    template <typename RawBoundaryTableType>
+    static void create_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_boundaries<SWE::EHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType&,
-        ProblemInputType& problem_input,
-        std::tuple<>&,
-        ProblemWriterType&) {}
-
-    template <typename RawBoundaryType, typename Communicator>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType& mesh,
-        ProblemInputType& input,
-        Communicator& communicator,
-        ProblemWriterType& writer) {
+    template <typename RawBoundaryTableType>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType&,
+                                              ProblemInputType& problem_input,
+                                              std::tuple<>&,
+                                              ProblemWriterType&) {}
+
+    template <typename RawBoundaryTableType, typename Communicator>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType& mesh,
+                                              ProblemInputType& input,
+                                              Communicator& communicator,
+                                              ProblemWriterType& writer) {
         // *** //
         SWE::create_distributed_boundaries<SWE::EHDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
@@ -278,6 +279,15 @@ struct Problem {
 
     template <typename GlobalDataType>
     static void finalize_simulation(GlobalDataType& global_data) {}
+
+    // the global trace problem is set up for a fixed assignment of submeshes to ranks
+    static constexpr bool ompi_repartitioning = false;
+
+    // no scalars are reduced across ranks during time stepping
+    template <typename OMPIReducerType>
+    static void initialize_reductions_ompi(OMPIReducerType&) {}
+
+    static void monitor_reductions_ompi(const std::vector<double>&, const std::vector<double>&, const bool) {}
 };
 }
 }
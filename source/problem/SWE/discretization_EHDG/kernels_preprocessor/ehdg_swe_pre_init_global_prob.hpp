@@ -56,17 +56,14 @@ void Problem::initialize_global_problem_parallel_pre_send(HDGDiscretization<Prob
 
         uint ngp = edge_dbound.edge_data.get_ngp();
 
-        // Construct message to exterior state
-        std::vector<double> message;
-
-        message.reserve(ngp);
+        // Construct message to exterior state directly in send buffer
+        auto message =
+            edge_dbound.boundary.boundary_condition.exchanger.GetSendMessage(CommTypes::init_global_prob, ngp);
 
         for (uint gp = 0; gp < ngp; ++gp) {
-            message.push_back(boundary.aux_at_gp(SWE::Auxiliaries::bath, gp));
+            message[gp] = boundary.aux_at_gp(SWE::Auxiliaries::bath, gp);
         }
 
-        edge_dbound.boundary.boundary_condition.exchanger.SetToSendBuffer(CommTypes::init_global_prob, message);
-
         set_constant(edge_dbound.edge_data.edge_state.q_hat, 0.0);
 
         // Initialize delta_hat_global and rhs_global containers
@@ -85,10 +82,10 @@ void Problem::initialize_global_problem_parallel_post_receive(HDGDiscretization<
 
         uint ngp = edge_dbound.edge_data.get_ngp();
 
-        std::vector<double> message(ngp);
-        DynRowVector<double> bath_ex(ngp);
+        auto message =
+            edge_dbound.boundary.boundary_condition.exchanger.GetReceiveMessage(CommTypes::init_global_prob, ngp);
 
-        edge_dbound.boundary.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::init_global_prob, message);
+        DynRowVector<double> bath_ex(ngp);
 
         for (uint gp = 0; gp < ngp; ++gp) {
             bath_ex[ngp - gp - 1] = message[gp];
@@ -10,31 +10,25 @@ void Problem::global_distributed_boundary_kernel(const ProblemStepperType& stepp
 
     boundary.q_at_gp = dbound.ComputeUgp(state.q);
 
-    // Construct message to exterior state
-    std::vector<double> message;
+    // Construct message to exterior state directly in send buffer
+    const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
 
-    message.reserve(1 + SWE::n_variables * dbound.data.get_ngp_boundary(dbound.bound_id));
+    auto message =
+        dbound.boundary_condition.exchanger.GetSendMessage(CommTypes::bound_state, 1 + SWE::n_variables * ngp);
 
-    message.push_back(dbound.data.wet_dry_state.wet);
+    message[0] = dbound.data.wet_dry_state.wet;
 
-    for (uint gp = 0; gp < dbound.data.get_ngp_boundary(dbound.bound_id); ++gp) {
+    for (uint gp = 0; gp < ngp; ++gp) {
         for (uint var = 0; var < SWE::n_variables; ++var) {
-            message.push_back(boundary.q_at_gp(var, gp));
+            message[1 + SWE::n_variables * gp + var] = boundary.q_at_gp(var, gp);
         }
     }
-
-    // Set message to send buffer
-    dbound.boundary_condition.exchanger.SetToSendBuffer(CommTypes::bound_state, message);
 }
 
 template <typename DistributedBoundaryType>
 void Problem::local_distributed_boundary_kernel(const ProblemStepperType& stepper, DistributedBoundaryType& dbound) {
-    // Get message from exterior state
-    std::vector<double> message;
-
-    message.resize(1);  // just wet/dry state info
-
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::bound_state, message);
+    // Get message from exterior state, just wet/dry state info
+    auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::bound_state, 1);
 
     bool wet_ex = (bool)message[0];
 
@@ -19,10 +19,11 @@ void Problem::local_volume_kernel(const ProblemStepperType& stepper, ElementType
         row(internal.aux_at_gp, SWE::Auxiliaries::h) =
             row(internal.q_at_gp, SWE::Variables::ze) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
 
-        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, internal.Fx_at_gp, internal.Fy_at_gp);
+        auto& scratch = SWE::volume_scratch(elt.data.get_ngp_internal());
 
-        state.rhs = elt.IntegrationDPhi(GlobalCoord::x, internal.Fx_at_gp) +
-                    elt.IntegrationDPhi(GlobalCoord::y, internal.Fy_at_gp);
+        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, scratch.Fx, scratch.Fy);
+
+        state.rhs = elt.IntegrationDPhi(GlobalCoord::x, scratch.Fx) + elt.IntegrationDPhi(GlobalCoord::y, scratch.Fy);
     }
 }
 }
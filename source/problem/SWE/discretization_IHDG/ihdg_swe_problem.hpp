@@ -15,7 +15,7 @@
 #include "dist_boundary_conditions/ihdg_swe_distributed_boundary_conditions.hpp"
 #include "interface_specializations/ihdg_swe_interface_specializations.hpp"
 
-#include "problem/SWE/problem_data_structure/swe_data.hpp"
+#include "problem/SWE/problem_data_structure/swe_data_ihdg.hpp"
 #include "problem/SWE/problem_data_structure/swe_edge_data.hpp"
 #include "problem/SWE/problem_data_structure/swe_global_data.hpp"
 
@@ -43,7 +43,7 @@ struct Problem {
     using ProblemWriterType  = Writer<Problem>;
     using ProblemParserType  = SWE::Parser;
 
-    using ProblemDataType       = SWE::Data;
+    using ProblemDataType       = IHDG::Data;
     using ProblemEdgeDataType   = SWE::EdgeData;
     using ProblemGlobalDataType = SWE::GlobalData;
 
@@ -96,37 +96,38 @@ struct Problem {
         return offset;
     }
 
-    template <typename RawBoundaryType>
-    static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    // traces are coupled through the global problem, nothing is exchanged in single precision
+    static std::vector<uint> single_precision_comms() { return std::vector<uint>(); }
+
+    template <typename RawBoundaryTableType>
+    static void create_interfaces(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_interfaces<SWE::IHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    template <typename RawBoundaryTableType>
+    static void create_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_boundaries<SWE::IHDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType&,
-        ProblemInputType& problem_input,
-        std::tuple<>&,
-        ProblemWriterType&) {}
-
-    template <typename RawBoundaryType, typename Communicator>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType& mesh,
-        ProblemInputType& input,
-        Communicator& communicator,
-        ProblemWriterType& writer) {
+    template <typename RawBoundaryTableType>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType&,
+                                              ProblemInputType& problem_input,
+                                              std::tuple<>&,
+                                              ProblemWriterType&) {}
+
+    template <typename RawBoundaryTableType, typename Communicator>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType& mesh,
+                                              ProblemInputType& input,
+                                              Communicator& communicator,
+                                              ProblemWriterType& writer) {
         // *** //
         SWE::create_distributed_boundaries<SWE::IHDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
@@ -236,6 +237,12 @@ struct Problem {
     template <typename EdgeDistributedType>
     static void init_edge_distributed_kernel(const ProblemStepperType& stepper, EdgeDistributedType& edge_dbound);
 
+    template <typename ElementType>
+    static void init_stage_rhs_kernel(const ProblemStepperType& stepper, ElementType& elt);
+
+    template <typename EdgeDataType>
+    static void predict_edge_state(const ProblemStepperType& stepper, EdgeDataType& edge_data);
+
     /* init interation end */
 
     /* local step begin */
@@ -318,6 +325,13 @@ struct Problem {
         global_data.destroy();
 #endif
     }
+
+    static constexpr bool ompi_repartitioning = false;
+
+    template <typename OMPIReducerType>
+    static void initialize_reductions_ompi(OMPIReducerType&) {}
+
+    static void monitor_reductions_ompi(const std::vector<double>&, const std::vector<double>&, const bool) {}
 };
 }
 }
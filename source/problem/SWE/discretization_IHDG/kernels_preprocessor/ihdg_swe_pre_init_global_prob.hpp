@@ -7,13 +7,16 @@ template <typename ProblemType>
 void Problem::initialize_global_problem_serial(HDGDiscretization<ProblemType>& discretization,
                                                const ProblemStepperType& stepper,
                                                uint& global_dof_offset) {
-    discretization.mesh.CallForEachElement([](auto& elt) {
+    discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         auto& internal = elt.data.internal;
 
         // Initialize delta_local and rhs_local containers
         internal.delta_local.resize(SWE::n_variables * elt.data.get_ndof(), SWE::n_variables * elt.data.get_ndof());
         internal.rhs_local.resize(SWE::n_variables * elt.data.get_ndof());
         internal.rhs_prev.resize(SWE::n_variables * elt.data.get_ndof());
+        internal.rhs_stages.resize(stepper.GetNumStages() - 1,
+                                   DynVector<double>(SWE::n_variables * elt.data.get_ndof()));
+        internal.del_q_local.resize(SWE::n_variables * elt.data.get_ndof());
     });
 
     discretization.mesh_skeleton.CallForEachEdgeInterface([&global_dof_offset](auto& edge_int) {
@@ -194,19 +197,20 @@ void Problem::initialize_global_problem_parallel_finalize_pre_send(HDGDiscretiza
 
         boundary.q_at_gp = dbound.ComputeUgp(state.q);
 
-        // Construct message to exterior state
-        std::vector<double> message;
+        // Construct message to exterior state directly in send buffer
+        const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
 
-        message.reserve(1 + (SWE::n_variables + 1) * dbound.data.get_ngp_boundary(dbound.bound_id));
+        auto message = edge_dbound.boundary.boundary_condition.exchanger.GetSendMessage(
+            CommTypes::init_global_prob, 1 + (SWE::n_variables + 1) * ngp);
 
-        for (uint gp = 0; gp < dbound.data.get_ngp_boundary(dbound.bound_id); ++gp) {
+        for (uint gp = 0; gp < ngp; ++gp) {
             for (uint var = 0; var < SWE::n_variables; ++var) {
-                message.push_back(boundary.q_at_gp(var, gp));
+                message[SWE::n_variables * gp + var] = boundary.q_at_gp(var, gp);
             }
         }
 
-        for (uint gp = 0; gp < dbound.data.get_ngp_boundary(dbound.bound_id); ++gp) {
-            message.push_back(boundary.aux_at_gp(SWE::Auxiliaries::bath, gp));
+        for (uint gp = 0; gp < ngp; ++gp) {
+            message[SWE::n_variables * ngp + gp] = boundary.aux_at_gp(SWE::Auxiliaries::bath, gp);
         }
 
         uint ndof_global = edge_dbound.edge_data.get_ndof();
@@ -224,10 +228,8 @@ void Problem::initialize_global_problem_parallel_finalize_pre_send(HDGDiscretiza
 
             boundary.global_dof_indx = edge_internal.global_dof_indx;
 
-            message.push_back((double)edge_internal.global_dof_indx[0]);
+            message[(SWE::n_variables + 1) * ngp] = (double)edge_internal.global_dof_indx[0];
         }
-
-        edge_dbound.boundary.boundary_condition.exchanger.SetToSendBuffer(CommTypes::init_global_prob, message);
     });
 }
 
@@ -266,12 +268,12 @@ void Problem::initialize_global_problem_parallel_post_receive(HDGDiscretization<
 
         uint ngp = edge_dbound.edge_data.get_ngp();
 
-        std::vector<double> message(1 + (SWE::n_variables + 1) * ngp);
+        auto message = edge_dbound.boundary.boundary_condition.exchanger.GetReceiveMessage(
+            CommTypes::init_global_prob, 1 + (SWE::n_variables + 1) * ngp);
+
         HybMatrix<double, SWE::n_variables> q_ex(SWE::n_variables, ngp);
         DynRowVector<double> bath_ex(ngp);
 
-        edge_dbound.boundary.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::init_global_prob, message);
-
         uint gp_ex;
         for (uint gp = 0; gp < ngp; ++gp) {
             gp_ex = ngp - gp - 1;
@@ -298,7 +300,7 @@ void Problem::initialize_global_problem_parallel_post_receive(HDGDiscretization<
         uint submesh_ex  = edge_dbound.boundary.boundary_condition.exchanger.submesh_ex;
 
         if (locality_in > locality_ex || (locality_in == locality_ex && submesh_in > submesh_ex)) {
-            uint global_dof_offset = (uint)message.back();
+            uint global_dof_offset = (uint)message[(SWE::n_variables + 1) * ngp];
 
             edge_internal.global_dof_indx.resize(ndof_global * SWE::n_variables);
 
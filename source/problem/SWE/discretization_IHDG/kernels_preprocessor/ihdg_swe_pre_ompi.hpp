@@ -59,6 +59,8 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType<Prob
             }
         }
 
+        const uint n_local_global_dofs = total_global_dof_offset;
+
         int n_localities;
         int locality_id;
 
@@ -107,17 +109,54 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType<Prob
                     0,
                     MPI_COMM_WORLD);
 
-        MatCreate(MPI_COMM_WORLD, &(global_data.delta_hat_global));
-        MatSetSizes(global_data.delta_hat_global, PETSC_DECIDE, PETSC_DECIDE, n_global_dofs, n_global_dofs);
-        MatSetUp(global_data.delta_hat_global);
-
-        VecCreateMPI(MPI_COMM_WORLD, PETSC_DECIDE, n_global_dofs, &(global_data.rhs_global));
-
-        KSPCreate(MPI_COMM_WORLD, &(global_data.ksp));
-        KSPSetOperators(global_data.ksp, global_data.delta_hat_global, global_data.delta_hat_global);
-
-        KSPGetPC(global_data.ksp, &(global_data.pc));
-        PCSetType(global_data.pc, PCLU);
+        if (SWE::GlobalProblem::matrix_free) {
+            // Align PETSc ownership with locality dofs, so that applying the operator
+            // to locally owned edges does not require communication
+            MatCreateShell(MPI_COMM_WORLD,
+                           n_local_global_dofs,
+                           n_local_global_dofs,
+                           n_global_dofs,
+                           n_global_dofs,
+                           &(global_data.delta_hat_global_apply),
+                           &(global_data.delta_hat_global));
+            MatShellSetOperation(
+                global_data.delta_hat_global, MATOP_MULT, (void (*)(void))SWE::GlobalData::apply_matrix_free);
+
+            MatCreate(MPI_COMM_WORLD, &(global_data.delta_hat_global_precon));
+            MatSetSizes(global_data.delta_hat_global_precon,
+                        n_local_global_dofs,
+                        n_local_global_dofs,
+                        n_global_dofs,
+                        n_global_dofs);
+            MatSetUp(global_data.delta_hat_global_precon);
+
+            VecCreateMPI(MPI_COMM_WORLD, n_local_global_dofs, n_global_dofs, &(global_data.rhs_global));
+
+            KSPCreate(MPI_COMM_WORLD, &(global_data.ksp));
+            KSPSetOperators(global_data.ksp, global_data.delta_hat_global, global_data.delta_hat_global_precon);
+            KSPSetType(global_data.ksp, KSPGMRES);
+            KSPGMRESSetRestart(global_data.ksp, SWE::GlobalProblem::restart);
+            KSPSetTolerances(global_data.ksp,
+                             SWE::GlobalProblem::tolerance,
+                             PETSC_DEFAULT,
+                             PETSC_DEFAULT,
+                             SWE::GlobalProblem::max_iterations);
+
+            KSPGetPC(global_data.ksp, &(global_data.pc));
+            PCSetType(global_data.pc, PCBJACOBI);
+        } else {
+            MatCreate(MPI_COMM_WORLD, &(global_data.delta_hat_global));
+            MatSetSizes(global_data.delta_hat_global, PETSC_DECIDE, PETSC_DECIDE, n_global_dofs, n_global_dofs);
+            MatSetUp(global_data.delta_hat_global);
+
+            VecCreateMPI(MPI_COMM_WORLD, PETSC_DECIDE, n_global_dofs, &(global_data.rhs_global));
+
+            KSPCreate(MPI_COMM_WORLD, &(global_data.ksp));
+            KSPSetOperators(global_data.ksp, global_data.delta_hat_global, global_data.delta_hat_global);
+
+            KSPGetPC(global_data.ksp, &(global_data.pc));
+            PCSetType(global_data.pc, PCLU);
+        }
 
         for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
             sim_units[su_id]->communicator.ReceiveAll(CommTypes::init_global_prob, 0);
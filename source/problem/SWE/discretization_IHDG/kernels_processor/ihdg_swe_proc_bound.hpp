@@ -5,7 +5,7 @@ namespace SWE {
 namespace IHDG {
 template <typename BoundaryType>
 void Problem::init_boundary_kernel(const ProblemStepperType& stepper, BoundaryType& bound) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         const uint stage = stepper.GetStage();
 
         auto& state_prev = bound.data.state[stage];
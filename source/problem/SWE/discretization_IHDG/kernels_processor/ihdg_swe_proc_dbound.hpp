@@ -5,7 +5,7 @@ namespace SWE {
 namespace IHDG {
 template <typename DistributedBoundaryType>
 void Problem::init_distributed_boundary_kernel(const ProblemStepperType& stepper, DistributedBoundaryType& dbound) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         const uint stage = stepper.GetStage();
 
         auto& state_prev = dbound.data.state[stage];
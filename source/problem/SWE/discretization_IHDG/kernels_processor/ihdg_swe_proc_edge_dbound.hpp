@@ -7,7 +7,7 @@ namespace SWE {
 namespace IHDG {
 template <typename EdgeDistributedType>
 void Problem::init_edge_distributed_kernel(const ProblemStepperType& stepper, EdgeDistributedType& edge_dbound) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         auto& edge_state    = edge_dbound.edge_data.edge_state;
         auto& edge_internal = edge_dbound.edge_data.edge_internal;
 
@@ -89,7 +89,7 @@ void Problem::local_edge_distributed_kernel(const ProblemStepperType& stepper, E
         column(boundary.dF_hat_dq_hat_at_gp, gp) += flatten<double>(dtau_delq - edge_internal.tau[gp]);
     }
 
-    double theta = stepper.GetTheta();
+    const double implicit_weight = stepper.GetImplicitWeight();
 
     for (uint dof_i = 0; dof_i < edge_dbound.boundary.data.get_ndof(); ++dof_i) {
         for (uint dof_j = 0; dof_j < edge_dbound.boundary.data.get_ndof(); ++dof_j) {
@@ -99,11 +99,11 @@ void Problem::local_edge_distributed_kernel(const ProblemStepperType& stepper, E
                       SWE::n_variables,
                       SWE::n_variables) +=
                 reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_dbound.boundary.IntegrationPhiPhi(dof_j, dof_i, boundary.dF_hat_dq_at_gp));
+                    implicit_weight * edge_dbound.boundary.IntegrationPhiPhi(dof_j, dof_i, boundary.dF_hat_dq_at_gp));
         }
 
         subvector(internal.rhs_local, SWE::n_variables * dof_i, SWE::n_variables) +=
-            -(1.0 - theta) * edge_dbound.boundary.IntegrationPhi(dof_i, boundary.F_hat_at_gp);
+            -implicit_weight * edge_dbound.boundary.IntegrationPhi(dof_i, boundary.F_hat_at_gp);
     }
 
     for (uint dof_i = 0; dof_i < edge_dbound.boundary.data.get_ndof(); ++dof_i) {
@@ -114,7 +114,7 @@ void Problem::local_edge_distributed_kernel(const ProblemStepperType& stepper, E
                       SWE::n_variables,
                       SWE::n_variables) =
                 reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_dbound.IntegrationPhiLambda(dof_i, dof_j, boundary.dF_hat_dq_hat_at_gp));
+                    implicit_weight * edge_dbound.IntegrationPhiLambda(dof_i, dof_j, boundary.dF_hat_dq_hat_at_gp));
         }
     }
 }
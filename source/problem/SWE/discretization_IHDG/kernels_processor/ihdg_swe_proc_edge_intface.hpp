@@ -7,7 +7,7 @@ namespace SWE {
 namespace IHDG {
 template <typename EdgeInterfaceType>
 void Problem::init_edge_interface_kernel(const ProblemStepperType& stepper, EdgeInterfaceType& edge_int) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         auto& edge_state    = edge_int.edge_data.edge_state;
         auto& edge_internal = edge_int.edge_data.edge_internal;
 
@@ -125,7 +125,7 @@ void Problem::local_edge_interface_kernel(const ProblemStepperType& stepper, Edg
         column(boundary_ex.dF_hat_dq_hat_at_gp, gp_ex) += flatten<double>(dtau_delq_ex - edge_internal.tau[gp]);
     }
 
-    double theta = stepper.GetTheta();
+    const double implicit_weight = stepper.GetImplicitWeight();
 
     for (uint dof_i = 0; dof_i < edge_int.interface.data_in.get_ndof(); ++dof_i) {
         for (uint dof_j = 0; dof_j < edge_int.interface.data_in.get_ndof(); ++dof_j) {
@@ -134,12 +134,12 @@ void Problem::local_edge_interface_kernel(const ProblemStepperType& stepper, Edg
                       SWE::n_variables * dof_j,
                       SWE::n_variables,
                       SWE::n_variables) +=
-                reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_int.interface.IntegrationPhiPhiIN(dof_i, dof_j, boundary_in.dF_hat_dq_at_gp));
+                reshape<double, SWE::n_variables>(implicit_weight * edge_int.interface.IntegrationPhiPhiIN(
+                                                                        dof_i, dof_j, boundary_in.dF_hat_dq_at_gp));
         }
 
         subvector(internal_in.rhs_local, SWE::n_variables * dof_i, SWE::n_variables) +=
-            -(1.0 - theta) * edge_int.interface.IntegrationPhiIN(dof_i, boundary_in.F_hat_at_gp);
+            -implicit_weight * edge_int.interface.IntegrationPhiIN(dof_i, boundary_in.F_hat_at_gp);
     }
 
     for (uint dof_i = 0; dof_i < edge_int.interface.data_ex.get_ndof(); ++dof_i) {
@@ -149,12 +149,12 @@ void Problem::local_edge_interface_kernel(const ProblemStepperType& stepper, Edg
                       SWE::n_variables * dof_j,
                       SWE::n_variables,
                       SWE::n_variables) +=
-                reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_int.interface.IntegrationPhiPhiEX(dof_i, dof_j, boundary_ex.dF_hat_dq_at_gp));
+                reshape<double, SWE::n_variables>(implicit_weight * edge_int.interface.IntegrationPhiPhiEX(
+                                                                        dof_i, dof_j, boundary_ex.dF_hat_dq_at_gp));
         }
 
         subvector(internal_ex.rhs_local, SWE::n_variables * dof_i, SWE::n_variables) +=
-            -(1.0 - theta) * edge_int.interface.IntegrationPhiEX(dof_i, boundary_ex.F_hat_at_gp);
+            -implicit_weight * edge_int.interface.IntegrationPhiEX(dof_i, boundary_ex.F_hat_at_gp);
     }
 
     for (uint dof_i = 0; dof_i < edge_int.interface.data_in.get_ndof(); ++dof_i) {
@@ -165,7 +165,7 @@ void Problem::local_edge_interface_kernel(const ProblemStepperType& stepper, Edg
                       SWE::n_variables,
                       SWE::n_variables) =
                 reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_int.IntegrationPhiLambdaIN(dof_i, dof_j, boundary_in.dF_hat_dq_hat_at_gp));
+                    implicit_weight * edge_int.IntegrationPhiLambdaIN(dof_i, dof_j, boundary_in.dF_hat_dq_hat_at_gp));
         }
     }
 
@@ -177,7 +177,7 @@ void Problem::local_edge_interface_kernel(const ProblemStepperType& stepper, Edg
                       SWE::n_variables,
                       SWE::n_variables) =
                 reshape<double, SWE::n_variables>(
-                    (1.0 - theta) * edge_int.IntegrationPhiLambdaEX(dof_i, dof_j, boundary_ex.dF_hat_dq_hat_at_gp));
+                    implicit_weight * edge_int.IntegrationPhiLambdaEX(dof_i, dof_j, boundary_ex.dF_hat_dq_hat_at_gp));
         }
     }
 }
@@ -25,6 +25,46 @@ void Problem::init_iteration(const ProblemStepperType& stepper, HDGDiscretizatio
 
     discretization.mesh_skeleton.CallForEachEdgeDistributed(
         [&stepper](auto& edge_bound) { Problem::init_edge_distributed_kernel(stepper, edge_bound); });
+
+    discretization.mesh.CallForEachElement([&stepper](auto& elt) { Problem::init_stage_rhs_kernel(stepper, elt); });
+
+    // extrapolate traces only after the init kernels, which use the trace at the current time level
+    if (SWE::GlobalProblem::predictor_order != 0 && stepper.GetStage() == 0) {
+        discretization.mesh_skeleton.CallForEachEdgeInterface(
+            [&stepper](auto& edge_int) { Problem::predict_edge_state(stepper, edge_int.edge_data); });
+
+        discretization.mesh_skeleton.CallForEachEdgeBoundary(
+            [&stepper](auto& edge_bound) { Problem::predict_edge_state(stepper, edge_bound.edge_data); });
+
+        discretization.mesh_skeleton.CallForEachEdgeDistributed(
+            [&stepper](auto& edge_dbound) { Problem::predict_edge_state(stepper, edge_dbound.edge_data); });
+    }
+}
+
+template <typename EdgeDataType>
+void Problem::predict_edge_state(const ProblemStepperType& stepper, EdgeDataType& edge_data) {
+    auto& edge_state    = edge_data.edge_state;
+    auto& edge_internal = edge_data.edge_internal;
+
+    // number of previous time levels available limits the order of extrapolation
+    const uint order = std::min(SWE::GlobalProblem::predictor_order, stepper.GetStep());
+
+    if (order == 0) {
+        edge_internal.q_hat_nm1 = edge_state.q_hat;
+    } else if (order == 1) {
+        if (SWE::GlobalProblem::predictor_order == 2) {
+            edge_internal.q_hat_nm2 = edge_internal.q_hat_nm1;
+        }
+
+        // q_hat_pred = 2 * q_hat_n - q_hat_nm1, afterwards q_hat_nm1 <- q_hat_n
+        edge_internal.q_hat_nm1 = 2.0 * edge_state.q_hat - edge_internal.q_hat_nm1;
+        std::swap(edge_state.q_hat, edge_internal.q_hat_nm1);
+    } else {
+        // q_hat_pred = 3 * q_hat_n - 3 * q_hat_nm1 + q_hat_nm2, afterwards q_hat_nm2 <- q_hat_nm1, q_hat_nm1 <- q_hat_n
+        edge_internal.q_hat_nm2 += 3.0 * (edge_state.q_hat - edge_internal.q_hat_nm1);
+        std::swap(edge_internal.q_hat_nm2, edge_internal.q_hat_nm1);
+        std::swap(edge_state.q_hat, edge_internal.q_hat_nm1);
+    }
 }
 }
 }
@@ -5,7 +5,7 @@ namespace SWE {
 namespace IHDG {
 template <typename InterfaceType>
 void Problem::init_interface_kernel(const ProblemStepperType& stepper, InterfaceType& intface) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         const uint stage = stepper.GetStage();
 
         auto& state_prev_in = intface.data_in.state[stage];
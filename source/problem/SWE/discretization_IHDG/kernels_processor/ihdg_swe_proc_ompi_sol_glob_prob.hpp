@@ -9,121 +9,183 @@ bool Problem::ompi_solve_global_problem(std::vector<std::unique_ptr<OMPISimUnitT
                                         const ProblemStepperType& stepper,
                                         const uint begin_sim_id,
                                         const uint end_sim_id) {
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
-            auto& internal = elt.data.internal;
+    if (SWE::GlobalProblem::matrix_free) {
+        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
+                auto& internal = elt.data.internal;
 
-            internal.delta_local_inv = inverse(internal.delta_local);
-        });
+                internal.delta_local_inv = inverse(internal.delta_local);
+            });
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
-            auto& edge_internal = edge_int.edge_data.edge_internal;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
 
-            auto& internal_in = edge_int.interface.data_in.internal;
-            auto& internal_ex = edge_int.interface.data_ex.internal;
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
 
-            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
-            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-            edge_internal.delta_hat_global -=
-                boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
-                boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local;
+                DynMatrix<double> delta_hat_global_diag =
+                    edge_internal.delta_hat_global -
+                    (boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
+                     boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local);
 
-            edge_internal.rhs_global -= boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
-                                        boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
+                edge_internal.rhs_global -=
+                    boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
+                    boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
 
-            edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
+                edge_internal.delta_hat_global_flat = flatten<double>(delta_hat_global_diag);
+            });
 
-            uint bcon_id = 0;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-            for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-                if (bound_id == edge_int.interface.bound_id_in)
-                    continue;
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-                auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+                DynMatrix<double> delta_hat_global_diag =
+                    edge_internal.delta_hat_global -
+                    boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
 
-                edge_internal.delta_hat_global =
-                    -boundary_in.delta_global * internal_in.delta_local_inv * boundary_con.delta_hat_local;
+                edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
 
-                edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+                edge_internal.delta_hat_global_flat = flatten<double>(delta_hat_global_diag);
+            });
 
-                ++bcon_id;
-            }
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
+                auto& edge_internal = edge_dbound.edge_data.edge_internal;
 
-            for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-                if (bound_id == edge_int.interface.bound_id_ex)
-                    continue;
+                auto& internal = edge_dbound.boundary.data.internal;
+                auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
 
-                auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+                DynMatrix<double> delta_hat_global_diag =
+                    edge_internal.delta_hat_global -
+                    boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
 
-                edge_internal.delta_hat_global =
-                    -boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_con.delta_hat_local;
+                edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
 
-                edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+                edge_internal.delta_hat_global_flat = flatten<double>(delta_hat_global_diag);
+            });
+        }
+    } else {
+        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
+                auto& internal = elt.data.internal;
 
-                ++bcon_id;
-            }
-        });
+                internal.delta_local_inv = inverse(internal.delta_local);
+            });
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
-            auto& edge_internal = edge_bound.edge_data.edge_internal;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface([](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
 
-            auto& internal = edge_bound.boundary.data.internal;
-            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
 
-            edge_internal.delta_hat_global -=
-                boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-            edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
+                edge_internal.delta_hat_global -=
+                    boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
+                    boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local;
 
-            edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
+                edge_internal.rhs_global -=
+                    boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
+                    boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
 
-            uint bcon_id = 0;
+                edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
 
-            for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-                if (bound_id == edge_bound.boundary.bound_id)
-                    continue;
+                uint bcon_id = 0;
 
-                auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+                for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_int.interface.bound_id_in)
+                        continue;
 
-                edge_internal.delta_hat_global =
-                    -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
+                    auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
 
-                edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+                    edge_internal.delta_hat_global =
+                        -boundary_in.delta_global * internal_in.delta_local_inv * boundary_con.delta_hat_local;
 
-                ++bcon_id;
-            }
-        });
+                    edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
 
-        sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
-            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+                    ++bcon_id;
+                }
 
-            auto& internal = edge_dbound.boundary.data.internal;
-            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+                for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_int.interface.bound_id_ex)
+                        continue;
 
-            edge_internal.delta_hat_global -=
-                boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
+                    auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-            edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
+                    edge_internal.delta_hat_global =
+                        -boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_con.delta_hat_local;
 
-            edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
+                    edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
 
-            uint bcon_id = 0;
+                    ++bcon_id;
+                }
+            });
 
-            for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
-                if (bound_id == edge_dbound.boundary.bound_id)
-                    continue;
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary([](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-                auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-                edge_internal.delta_hat_global =
-                    -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
+                edge_internal.delta_hat_global -=
+                    boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
 
-                edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+                edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
 
-                ++bcon_id;
-            }
-        });
+                edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
+
+                uint bcon_id = 0;
+
+                for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_bound.boundary.bound_id)
+                        continue;
+
+                    auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+
+                    edge_internal.delta_hat_global =
+                        -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
+
+                    edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+
+                    ++bcon_id;
+                }
+            });
+
+            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed([](auto& edge_dbound) {
+                auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                auto& internal = edge_dbound.boundary.data.internal;
+                auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                edge_internal.delta_hat_global -=
+                    boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
+
+                edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
+
+                edge_internal.delta_hat_global_flat = flatten<double>(edge_internal.delta_hat_global);
+
+                uint bcon_id = 0;
+
+                for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
+                    if (bound_id == edge_dbound.boundary.bound_id)
+                        continue;
+
+                    auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+
+                    edge_internal.delta_hat_global =
+                        -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
+
+                    edge_internal.delta_hat_global_con_flat[bcon_id] = flatten<double>(edge_internal.delta_hat_global);
+
+                    ++bcon_id;
+                }
+            });
+        }
     }
 
     Mat& delta_hat_global = global_data.delta_hat_global;
@@ -132,158 +194,368 @@ bool Problem::ompi_solve_global_problem(std::vector<std::unique_ptr<OMPISimUnitT
 #pragma omp barrier
 #pragma omp master
     {
-        for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
-                [&rhs_global, &delta_hat_global](auto& edge_int) {
-                    auto& edge_internal = edge_int.edge_data.edge_internal;
+        if (SWE::GlobalProblem::matrix_free) {
+            Mat& delta_hat_global_precon = global_data.delta_hat_global_precon;
+
+            // Only diagonal blocks are assembled for block Jacobi preconditioner
+            auto assemble_diag = [&rhs_global, &delta_hat_global_precon](auto& edge_internal) {
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                VecSetValues(rhs_global,
+                             global_dof_indx.size(),
+                             (int*)&global_dof_indx.front(),
+                             edge_internal.rhs_global.data(),
+                             ADD_VALUES);
+
+                MatSetValues(delta_hat_global_precon,
+                             global_dof_indx.size(),
+                             (int*)&global_dof_indx.front(),
+                             global_dof_indx.size(),
+                             (int*)&global_dof_indx.front(),
+                             edge_internal.delta_hat_global_flat.data(),
+                             ADD_VALUES);
+            };
+
+            for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                    [&assemble_diag](auto& edge_int) { assemble_diag(edge_int.edge_data.edge_internal); });
+
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                    [&assemble_diag](auto& edge_bound) { assemble_diag(edge_bound.edge_data.edge_internal); });
+
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                    [&assemble_diag](auto& edge_dbound) { assemble_diag(edge_dbound.edge_data.edge_internal); });
+            }
 
-                    std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+            MatAssemblyBegin(delta_hat_global_precon, MAT_FINAL_ASSEMBLY);
+            MatAssemblyEnd(delta_hat_global_precon, MAT_FINAL_ASSEMBLY);
 
-                    VecSetValues(rhs_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.rhs_global.data(),
-                                 ADD_VALUES);
+            VecAssemblyBegin(rhs_global);
+            VecAssemblyEnd(rhs_global);
 
-                    MatSetValues(delta_hat_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.delta_hat_global_flat.data(),
-                                 ADD_VALUES);
+            global_data.delta_hat_global_apply = [&sim_units, &global_data](Vec del_q_hat_global,
+                                                                            Vec delta_hat_del_q_hat_global) {
+                VecScatter& scatter = global_data.scatter;
+                Vec& sol            = global_data.sol;
 
-                    uint bcon_id = 0;
+                VecScatterBegin(scatter, del_q_hat_global, sol, INSERT_VALUES, SCATTER_FORWARD);
 
-                    for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_int.interface.bound_id_in)
-                            continue;
+                // Interface and boundary edge dofs are owned by this locality,
+                // their contributions are accumulated while the scatter is in flight
+                const double* del_q_hat_ptr;
+                VecGetArrayRead(del_q_hat_global, &del_q_hat_ptr);
 
-                        auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+                int owned_begin, owned_size;
+                VecGetOwnershipRange(del_q_hat_global, &owned_begin, nullptr);
+                VecGetLocalSize(del_q_hat_global, &owned_size);
 
-                        std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+                auto del_q_hat_owned = vector_from_array(const_cast<double*>(del_q_hat_ptr), owned_size);
 
-                        MatSetValues(delta_hat_global,
-                                     global_dof_indx.size(),
-                                     (int*)&global_dof_indx.front(),
-                                     global_dof_con_indx.size(),
-                                     (int*)&global_dof_con_indx.front(),
-                                     edge_internal.delta_hat_global_con_flat[bcon_id].data(),
-                                     ADD_VALUES);
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh.CallForEachElement(
+                        [](auto& elt) { set_constant(elt.data.internal.del_q_local, 0.0); });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                        [&del_q_hat_owned, owned_begin](auto& edge_int) {
+                            auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                            auto& internal_in = edge_int.interface.data_in.internal;
+                            auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                            auto del_q_hat = subvector(del_q_hat_owned,
+                                                       (uint)(global_dof_indx[0] - owned_begin),
+                                                       (uint)global_dof_indx.size());
+
+                            internal_in.del_q_local += boundary_in.delta_hat_local * del_q_hat;
+                            internal_ex.del_q_local += boundary_ex.delta_hat_local * del_q_hat;
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                        [&del_q_hat_owned, owned_begin](auto& edge_bound) {
+                            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                            auto& internal = edge_bound.boundary.data.internal;
+                            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                            auto del_q_hat = subvector(del_q_hat_owned,
+                                                       (uint)(global_dof_indx[0] - owned_begin),
+                                                       (uint)global_dof_indx.size());
+
+                            internal.del_q_local += boundary.delta_hat_local * del_q_hat;
+                        });
+                }
+
+                VecRestoreArrayRead(del_q_hat_global, &del_q_hat_ptr);
+
+                VecScatterEnd(scatter, del_q_hat_global, sol, INSERT_VALUES, SCATTER_FORWARD);
+
+                double* sol_ptr;
+                VecGetArray(sol, &sol_ptr);
 
-                        ++bcon_id;
-                    }
+                int sol_size;
+                VecGetLocalSize(sol, &sol_size);
 
-                    for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_int.interface.bound_id_ex)
-                            continue;
+                global_data.solution = vector_from_array(sol_ptr, sol_size);
 
-                        auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+                VecRestoreArray(sol, &sol_ptr);
 
-                        std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                        [&global_data](auto& edge_dbound) {
+                            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                            auto& internal = edge_dbound.boundary.data.internal;
+                            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                            uint n_global_dofs = edge_internal.global_dof_indx.size();
+
+                            auto del_q_hat = subvector(global_data.solution, edge_internal.sol_offset, n_global_dofs);
+
+                            internal.del_q_local += boundary.delta_hat_local * del_q_hat;
+                        });
+
+                    sim_units[su_id]->discretization.mesh.CallForEachElement([](auto& elt) {
+                        auto& internal = elt.data.internal;
+
+                        internal.del_q_local = internal.delta_local_inv * internal.del_q_local;
+                    });
+                }
+
+                VecZeroEntries(delta_hat_del_q_hat_global);
+
+                for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                        [&global_data, &delta_hat_del_q_hat_global](auto& edge_int) {
+                            auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                            auto& internal_in = edge_int.interface.data_in.internal;
+                            auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                            DynVector<double> delta_hat_del_q_hat =
+                                edge_internal.delta_hat_global *
+                                    subvector(global_data.solution, edge_internal.sol_offset, global_dof_indx.size()) -
+                                boundary_in.delta_global * internal_in.del_q_local -
+                                boundary_ex.delta_global * internal_ex.del_q_local;
+
+                            VecSetValues(delta_hat_del_q_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         delta_hat_del_q_hat.data(),
+                                         ADD_VALUES);
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                        [&global_data, &delta_hat_del_q_hat_global](auto& edge_bound) {
+                            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                            auto& internal = edge_bound.boundary.data.internal;
+                            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                            DynVector<double> delta_hat_del_q_hat =
+                                edge_internal.delta_hat_global *
+                                    subvector(global_data.solution, edge_internal.sol_offset, global_dof_indx.size()) -
+                                boundary.delta_global * internal.del_q_local;
+
+                            VecSetValues(delta_hat_del_q_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         delta_hat_del_q_hat.data(),
+                                         ADD_VALUES);
+                        });
+
+                    sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                        [&global_data, &delta_hat_del_q_hat_global](auto& edge_dbound) {
+                            auto& edge_internal = edge_dbound.edge_data.edge_internal;
+
+                            auto& internal = edge_dbound.boundary.data.internal;
+                            auto& boundary = edge_dbound.boundary.data.boundary[edge_dbound.boundary.bound_id];
+
+                            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                            DynVector<double> delta_hat_del_q_hat =
+                                edge_internal.delta_hat_global *
+                                    subvector(global_data.solution, edge_internal.sol_offset, global_dof_indx.size()) -
+                                boundary.delta_global * internal.del_q_local;
+
+                            VecSetValues(delta_hat_del_q_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         delta_hat_del_q_hat.data(),
+                                         ADD_VALUES);
+                        });
+                }
+
+                VecAssemblyBegin(delta_hat_del_q_hat_global);
+                VecAssemblyEnd(delta_hat_del_q_hat_global);
+            };
+        } else {
+            for (uint su_id = 0; su_id < sim_units.size(); ++su_id) {
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeInterface(
+                    [&rhs_global, &delta_hat_global](auto& edge_int) {
+                        auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                        std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                        VecSetValues(rhs_global,
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.rhs_global.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(delta_hat_global,
                                      global_dof_indx.size(),
                                      (int*)&global_dof_indx.front(),
-                                     global_dof_con_indx.size(),
-                                     (int*)&global_dof_con_indx.front(),
-                                     edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.delta_hat_global_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
+                        uint bcon_id = 0;
+
+                        for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_int.interface.bound_id_in)
+                                continue;
 
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
-                [&rhs_global, &delta_hat_global](auto& edge_bound) {
-                    auto& edge_internal = edge_bound.edge_data.edge_internal;
+                            auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
 
-                    std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+                            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-                    VecSetValues(rhs_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.rhs_global.data(),
-                                 ADD_VALUES);
+                            MatSetValues(delta_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         global_dof_con_indx.size(),
+                                         (int*)&global_dof_con_indx.front(),
+                                         edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
 
-                    MatSetValues(delta_hat_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.delta_hat_global_flat.data(),
-                                 ADD_VALUES);
+                            ++bcon_id;
+                        }
 
-                    uint bcon_id = 0;
+                        for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_int.interface.bound_id_ex)
+                                continue;
 
-                    for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_bound.boundary.bound_id)
-                            continue;
+                            auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-                        auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+                            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-                        std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+                            MatSetValues(delta_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         global_dof_con_indx.size(),
+                                         (int*)&global_dof_con_indx.front(),
+                                         edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
+
+                            ++bcon_id;
+                        }
+                    });
+
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                    [&rhs_global, &delta_hat_global](auto& edge_bound) {
+                        auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                        std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                        VecSetValues(rhs_global,
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.rhs_global.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(delta_hat_global,
                                      global_dof_indx.size(),
                                      (int*)&global_dof_indx.front(),
-                                     global_dof_con_indx.size(),
-                                     (int*)&global_dof_con_indx.front(),
-                                     edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.delta_hat_global_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
+                        uint bcon_id = 0;
 
-            sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
-                [&rhs_global, &delta_hat_global](auto& edge_dbound) {
-                    auto& edge_internal = edge_dbound.edge_data.edge_internal;
+                        for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_bound.boundary.bound_id)
+                                continue;
 
-                    std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+                            auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
 
-                    VecSetValues(rhs_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.rhs_global.data(),
-                                 ADD_VALUES);
+                            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-                    MatSetValues(delta_hat_global,
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 global_dof_indx.size(),
-                                 (int*)&global_dof_indx.front(),
-                                 edge_internal.delta_hat_global_flat.data(),
-                                 ADD_VALUES);
+                            MatSetValues(delta_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         global_dof_con_indx.size(),
+                                         (int*)&global_dof_con_indx.front(),
+                                         edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
 
-                    uint bcon_id = 0;
+                            ++bcon_id;
+                        }
+                    });
 
-                    for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
-                        if (bound_id == edge_dbound.boundary.bound_id)
-                            continue;
+                sim_units[su_id]->discretization.mesh_skeleton.CallForEachEdgeDistributed(
+                    [&rhs_global, &delta_hat_global](auto& edge_dbound) {
+                        auto& edge_internal = edge_dbound.edge_data.edge_internal;
 
-                        auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+                        std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
 
-                        std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+                        VecSetValues(rhs_global,
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.rhs_global.data(),
+                                     ADD_VALUES);
 
                         MatSetValues(delta_hat_global,
                                      global_dof_indx.size(),
                                      (int*)&global_dof_indx.front(),
-                                     global_dof_con_indx.size(),
-                                     (int*)&global_dof_con_indx.front(),
-                                     edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                     global_dof_indx.size(),
+                                     (int*)&global_dof_indx.front(),
+                                     edge_internal.delta_hat_global_flat.data(),
                                      ADD_VALUES);
 
-                        ++bcon_id;
-                    }
-                });
-        }
+                        uint bcon_id = 0;
+
+                        for (uint bound_id = 0; bound_id < edge_dbound.boundary.data.get_nbound(); ++bound_id) {
+                            if (bound_id == edge_dbound.boundary.bound_id)
+                                continue;
+
+                            auto& boundary_con = edge_dbound.boundary.data.boundary[bound_id];
+
+                            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-        MatAssemblyBegin(delta_hat_global, MAT_FINAL_ASSEMBLY);
-        MatAssemblyEnd(delta_hat_global, MAT_FINAL_ASSEMBLY);
+                            MatSetValues(delta_hat_global,
+                                         global_dof_indx.size(),
+                                         (int*)&global_dof_indx.front(),
+                                         global_dof_con_indx.size(),
+                                         (int*)&global_dof_con_indx.front(),
+                                         edge_internal.delta_hat_global_con_flat[bcon_id].data(),
+                                         ADD_VALUES);
 
-        VecAssemblyBegin(rhs_global);
-        VecAssemblyEnd(rhs_global);
+                            ++bcon_id;
+                        }
+                    });
+            }
+
+            MatAssemblyBegin(delta_hat_global, MAT_FINAL_ASSEMBLY);
+            MatAssemblyEnd(delta_hat_global, MAT_FINAL_ASSEMBLY);
+
+            VecAssemblyBegin(rhs_global);
+            VecAssemblyEnd(rhs_global);
+        }
 
         KSP& ksp            = global_data.ksp;
         Vec& sol            = global_data.sol;
@@ -318,7 +590,12 @@ bool Problem::ompi_solve_global_problem(std::vector<std::unique_ptr<OMPISimUnitT
             global_data.converged = false;
         }
 
-        MatZeroEntries(delta_hat_global);
+        if (SWE::GlobalProblem::matrix_free) {
+            MatZeroEntries(global_data.delta_hat_global_precon);
+        } else {
+            MatZeroEntries(delta_hat_global);
+        }
+
         VecZeroEntries(rhs_global);
     }
 #pragma omp barrier
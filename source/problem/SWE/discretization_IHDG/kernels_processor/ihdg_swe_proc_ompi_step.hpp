@@ -95,14 +95,17 @@ void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType
     { ++(stepper); }
 #pragma omp barrier
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-            uint n_stages = stepper.GetNumStages();
+    // multistage methods are stiffly accurate, i.e. the state at the last stage is the state at the next time level
+    if (stepper.GetStage() == 0) {
+        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+            sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
+                uint n_stages = stepper.GetNumStages();
 
-            auto& state = elt.data.state;
+                auto& state = elt.data.state;
 
-            std::swap(state[0].q, state[n_stages].q);
-        });
+                std::swap(state[0].q, state[n_stages].q);
+            });
+        }
     }
 
     if (SWE::PostProcessing::slope_limiting) {
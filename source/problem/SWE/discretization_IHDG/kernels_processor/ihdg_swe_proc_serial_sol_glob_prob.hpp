@@ -1,6 +1,8 @@
 #ifndef IHDG_SWE_PROC_SERIAL_SOL_GLOB_PROB_HPP
 #define IHDG_SWE_PROC_SERIAL_SOL_GLOB_PROB_HPP
 
+#include "utilities/linear_algebra/gmres.hpp"
+
 namespace SWE {
 namespace IHDG {
 template <typename ProblemType>
@@ -10,124 +12,279 @@ bool Problem::serial_solve_global_problem(HDGDiscretization<ProblemType>& discre
     SparseMatrix<double>& delta_hat_global = global_data.delta_hat_global;
     DynVector<double>& rhs_global          = global_data.rhs_global;
 
-    SparseMatrixMeta<double> sparse_delta_hat_global;
-
     discretization.mesh.CallForEachElement([](auto& elt) {
         auto& internal = elt.data.internal;
 
         internal.delta_local_inv = inverse(internal.delta_local);
     });
 
-    discretization.mesh_skeleton.CallForEachEdgeInterface([&rhs_global, &sparse_delta_hat_global](auto& edge_int) {
-        auto& edge_internal = edge_int.edge_data.edge_internal;
+    if (SWE::GlobalProblem::matrix_free) {
+        // Condense rhs and store inverses of condensed diagonal blocks for block Jacobi preconditioner,
+        // off-diagonal blocks are never formed
+        discretization.mesh_skeleton.CallForEachEdgeInterface([&rhs_global](auto& edge_int) {
+            auto& edge_internal = edge_int.edge_data.edge_internal;
 
-        auto& internal_in = edge_int.interface.data_in.internal;
-        auto& internal_ex = edge_int.interface.data_ex.internal;
+            auto& internal_in = edge_int.interface.data_in.internal;
+            auto& internal_ex = edge_int.interface.data_ex.internal;
 
-        auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
-        auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
 
-        std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
 
-        edge_internal.delta_hat_global -=
-            boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
-            boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local;
+            DynMatrix<double> delta_hat_global_diag =
+                edge_internal.delta_hat_global -
+                (boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
+                 boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local);
 
-        edge_internal.rhs_global -= boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
-                                    boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
+            edge_internal.delta_hat_global_inv = inverse(delta_hat_global_diag);
 
-        subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
+            edge_internal.rhs_global -= boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
+                                        boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
 
-        for (uint i = 0; i < global_dof_indx.size(); ++i) {
-            for (uint j = 0; j < global_dof_indx.size(); ++j) {
-                sparse_delta_hat_global.add_triplet(
-                    global_dof_indx[i], global_dof_indx[j], edge_internal.delta_hat_global(i, j));
-            }
+            subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
+        });
+
+        discretization.mesh_skeleton.CallForEachEdgeBoundary([&rhs_global](auto& edge_bound) {
+            auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+            auto& internal = edge_bound.boundary.data.internal;
+            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+            DynMatrix<double> delta_hat_global_diag =
+                edge_internal.delta_hat_global -
+                boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
+
+            edge_internal.delta_hat_global_inv = inverse(delta_hat_global_diag);
+
+            edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
+
+            subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
+        });
+
+        auto apply_delta_hat_global = [&discretization](const DynVector<double>& del_q_hat,
+                                                        DynVector<double>& delta_hat_del_q_hat) {
+            discretization.mesh.CallForEachElement([](auto& elt) { set_constant(elt.data.internal.del_q_local, 0.0); });
+
+            discretization.mesh_skeleton.CallForEachEdgeInterface([&del_q_hat](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                auto del_q_hat_edge = subvector(del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size());
+
+                internal_in.del_q_local += boundary_in.delta_hat_local * del_q_hat_edge;
+                internal_ex.del_q_local += boundary_ex.delta_hat_local * del_q_hat_edge;
+            });
+
+            discretization.mesh_skeleton.CallForEachEdgeBoundary([&del_q_hat](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                auto del_q_hat_edge = subvector(del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size());
+
+                internal.del_q_local += boundary.delta_hat_local * del_q_hat_edge;
+            });
+
+            discretization.mesh.CallForEachElement([](auto& elt) {
+                auto& internal = elt.data.internal;
+
+                internal.del_q_local = internal.delta_local_inv * internal.del_q_local;
+            });
+
+            discretization.mesh_skeleton.CallForEachEdgeInterface([&del_q_hat, &delta_hat_del_q_hat](auto& edge_int) {
+                auto& edge_internal = edge_int.edge_data.edge_internal;
+
+                auto& internal_in = edge_int.interface.data_in.internal;
+                auto& internal_ex = edge_int.interface.data_ex.internal;
+
+                auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+                auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                subvector(delta_hat_del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) =
+                    edge_internal.delta_hat_global *
+                        subvector(del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) -
+                    boundary_in.delta_global * internal_in.del_q_local -
+                    boundary_ex.delta_global * internal_ex.del_q_local;
+            });
+
+            discretization.mesh_skeleton.CallForEachEdgeBoundary([&del_q_hat, &delta_hat_del_q_hat](auto& edge_bound) {
+                auto& edge_internal = edge_bound.edge_data.edge_internal;
+
+                auto& internal = edge_bound.boundary.data.internal;
+                auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                subvector(delta_hat_del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) =
+                    edge_internal.delta_hat_global *
+                        subvector(del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) -
+                    boundary.delta_global * internal.del_q_local;
+            });
+        };
+
+        auto apply_block_jacobi = [&discretization](const DynVector<double>& del_q_hat,
+                                                    DynVector<double>& precon_del_q_hat) {
+            auto apply_block_inv = [&del_q_hat, &precon_del_q_hat](auto& edge_internal) {
+                std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+                subvector(precon_del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) =
+                    edge_internal.delta_hat_global_inv *
+                    subvector(del_q_hat, (uint)global_dof_indx[0], (uint)global_dof_indx.size());
+            };
+
+            discretization.mesh_skeleton.CallForEachEdgeInterface(
+                [&apply_block_inv](auto& edge_int) { apply_block_inv(edge_int.edge_data.edge_internal); });
+
+            discretization.mesh_skeleton.CallForEachEdgeBoundary(
+                [&apply_block_inv](auto& edge_bound) { apply_block_inv(edge_bound.edge_data.edge_internal); });
+        };
+
+        DynVector<double> del_q_hat = rhs_global;
+        set_constant(del_q_hat, 0.0);
+
+        const uint n_iterations = solve_gmres<double>(apply_delta_hat_global,
+                                                      apply_block_jacobi,
+                                                      rhs_global,
+                                                      del_q_hat,
+                                                      SWE::GlobalProblem::tolerance,
+                                                      SWE::GlobalProblem::max_iterations,
+                                                      SWE::GlobalProblem::restart);
+
+        if (n_iterations == SWE::GlobalProblem::max_iterations) {
+            std::cerr << "Warning: matrix-free global solver reached maximum number of iterations.\n";
         }
 
-        for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
-            if (bound_id == edge_int.interface.bound_id_in)
-                continue;
+        rhs_global = del_q_hat;
+    } else {
+        SparseMatrixMeta<double> sparse_delta_hat_global;
 
-            auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
+        discretization.mesh_skeleton.CallForEachEdgeInterface([&rhs_global, &sparse_delta_hat_global](auto& edge_int) {
+            auto& edge_internal = edge_int.edge_data.edge_internal;
 
-            edge_internal.delta_hat_global =
-                -boundary_in.delta_global * internal_in.delta_local_inv * boundary_con.delta_hat_local;
+            auto& internal_in = edge_int.interface.data_in.internal;
+            auto& internal_ex = edge_int.interface.data_ex.internal;
 
-            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+            auto& boundary_in = edge_int.interface.data_in.boundary[edge_int.interface.bound_id_in];
+            auto& boundary_ex = edge_int.interface.data_ex.boundary[edge_int.interface.bound_id_ex];
+
+            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+
+            edge_internal.delta_hat_global -=
+                boundary_in.delta_global * internal_in.delta_local_inv * boundary_in.delta_hat_local +
+                boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_ex.delta_hat_local;
+
+            edge_internal.rhs_global -= boundary_in.delta_global * internal_in.delta_local_inv * internal_in.rhs_local +
+                                        boundary_ex.delta_global * internal_ex.delta_local_inv * internal_ex.rhs_local;
+
+            subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
 
             for (uint i = 0; i < global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
+                for (uint j = 0; j < global_dof_indx.size(); ++j) {
                     sparse_delta_hat_global.add_triplet(
-                        global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                        global_dof_indx[i], global_dof_indx[j], edge_internal.delta_hat_global(i, j));
                 }
             }
-        }
 
-        for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
-            if (bound_id == edge_int.interface.bound_id_ex)
-                continue;
+            for (uint bound_id = 0; bound_id < edge_int.interface.data_in.get_nbound(); ++bound_id) {
+                if (bound_id == edge_int.interface.bound_id_in)
+                    continue;
 
-            auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
+                auto& boundary_con = edge_int.interface.data_in.boundary[bound_id];
 
-            edge_internal.delta_hat_global =
-                -boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_con.delta_hat_local;
+                edge_internal.delta_hat_global =
+                    -boundary_in.delta_global * internal_in.delta_local_inv * boundary_con.delta_hat_local;
 
-            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+                std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-            for (uint i = 0; i < global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
-                    sparse_delta_hat_global.add_triplet(
-                        global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                for (uint i = 0; i < global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
+                        sparse_delta_hat_global.add_triplet(
+                            global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                    }
                 }
             }
-        }
-    });
 
-    discretization.mesh_skeleton.CallForEachEdgeBoundary([&rhs_global, &sparse_delta_hat_global](auto& edge_bound) {
-        auto& edge_internal = edge_bound.edge_data.edge_internal;
+            for (uint bound_id = 0; bound_id < edge_int.interface.data_ex.get_nbound(); ++bound_id) {
+                if (bound_id == edge_int.interface.bound_id_ex)
+                    continue;
 
-        auto& internal = edge_bound.boundary.data.internal;
-        auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
+                auto& boundary_con = edge_int.interface.data_ex.boundary[bound_id];
 
-        std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
+                edge_internal.delta_hat_global =
+                    -boundary_ex.delta_global * internal_ex.delta_local_inv * boundary_con.delta_hat_local;
 
-        edge_internal.delta_hat_global -= boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
+                std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
 
-        edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
+                for (uint i = 0; i < global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
+                        sparse_delta_hat_global.add_triplet(
+                            global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                    }
+                }
+            }
+        });
 
-        subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
+        discretization.mesh_skeleton.CallForEachEdgeBoundary([&rhs_global, &sparse_delta_hat_global](auto& edge_bound) {
+            auto& edge_internal = edge_bound.edge_data.edge_internal;
 
-        for (uint i = 0; i < global_dof_indx.size(); ++i) {
-            for (uint j = 0; j < global_dof_indx.size(); ++j) {
-                sparse_delta_hat_global.add_triplet(
-                    global_dof_indx[i], global_dof_indx[j], edge_internal.delta_hat_global(i, j));
-            }
-        }
+            auto& internal = edge_bound.boundary.data.internal;
+            auto& boundary = edge_bound.boundary.data.boundary[edge_bound.boundary.bound_id];
 
-        for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
-            if (bound_id == edge_bound.boundary.bound_id)
-                continue;
+            std::vector<uint>& global_dof_indx = edge_internal.global_dof_indx;
 
-            auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+            edge_internal.delta_hat_global -=
+                boundary.delta_global * internal.delta_local_inv * boundary.delta_hat_local;
 
-            edge_internal.delta_hat_global =
-                -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
+            edge_internal.rhs_global -= boundary.delta_global * internal.delta_local_inv * internal.rhs_local;
 
-            std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+            subvector(rhs_global, (uint)global_dof_indx[0], (uint)global_dof_indx.size()) = edge_internal.rhs_global;
 
             for (uint i = 0; i < global_dof_indx.size(); ++i) {
-                for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
+                for (uint j = 0; j < global_dof_indx.size(); ++j) {
                     sparse_delta_hat_global.add_triplet(
-                        global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                        global_dof_indx[i], global_dof_indx[j], edge_internal.delta_hat_global(i, j));
                 }
             }
-        }
-    });
 
-    sparse_delta_hat_global.get_sparse_matrix(delta_hat_global);
+            for (uint bound_id = 0; bound_id < edge_bound.boundary.data.get_nbound(); ++bound_id) {
+                if (bound_id == edge_bound.boundary.bound_id)
+                    continue;
+
+                auto& boundary_con = edge_bound.boundary.data.boundary[bound_id];
+
+                edge_internal.delta_hat_global =
+                    -boundary.delta_global * internal.delta_local_inv * boundary_con.delta_hat_local;
 
-    solve_sle(delta_hat_global, rhs_global);
+                std::vector<uint>& global_dof_con_indx = boundary_con.global_dof_indx;
+
+                for (uint i = 0; i < global_dof_indx.size(); ++i) {
+                    for (uint j = 0; j < global_dof_con_indx.size(); ++j) {
+                        sparse_delta_hat_global.add_triplet(
+                            global_dof_indx[i], global_dof_con_indx[j], edge_internal.delta_hat_global(i, j));
+                    }
+                }
+            }
+        });
+
+        sparse_delta_hat_global.get_sparse_matrix(delta_hat_global);
+
+        solve_sle(delta_hat_global, rhs_global);
+    }
 
     discretization.mesh_skeleton.CallForEachEdgeInterface([&rhs_global](auto& edge_int) {
         auto& edge_state    = edge_int.edge_data.edge_state;
@@ -73,13 +73,16 @@ void Problem::stage_serial(HDGDiscretization<ProblemType>& discretization,
 
     ++stepper;
 
-    discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-        uint n_stages = stepper.GetNumStages();
+    // multistage methods are stiffly accurate, i.e. the state at the last stage is the state at the next time level
+    if (stepper.GetStage() == 0) {
+        discretization.mesh.CallForEachElement([&stepper](auto& elt) {
+            uint n_stages = stepper.GetNumStages();
 
-        auto& state = elt.data.state;
+            auto& state = elt.data.state;
 
-        std::swap(state[0].q, state[n_stages].q);
-    });
+            std::swap(state[0].q, state[n_stages].q);
+        });
+    }
 
     if (SWE::PostProcessing::slope_limiting) {
         CS_slope_limiter_serial(stepper, discretization);
@@ -7,7 +7,7 @@ namespace SWE {
 namespace IHDG {
 template <typename ElementType>
 void Problem::init_source_kernel(const ProblemStepperType& stepper, ElementType& elt) {
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         auto& internal = elt.data.internal;
 
         SWE::get_source(stepper.GetTimeAtCurrentStage(), elt);
@@ -66,7 +66,7 @@ void Problem::local_source_kernel(const ProblemStepperType& stepper, ElementType
 
     SWE::get_source(stepper.GetTimeAtNextStage(), elt);
 
-    double theta = stepper.GetTheta();
+    const double implicit_weight = stepper.GetImplicitWeight();
 
     for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
         for (uint dof_j = 0; dof_j < elt.data.get_ndof(); ++dof_j) {
@@ -75,12 +75,12 @@ void Problem::local_source_kernel(const ProblemStepperType& stepper, ElementType
                       SWE::n_variables * dof_j,
                       SWE::n_variables,
                       SWE::n_variables) -=
-                reshape<double, SWE::n_variables>((1.0 - theta) *
+                reshape<double, SWE::n_variables>(implicit_weight *
                                                   elt.IntegrationPhiPhi(dof_j, dof_i, internal.dsource_dq_at_gp));
         }
 
         subvector(internal.rhs_local, SWE::n_variables * dof_i, SWE::n_variables) +=
-            (1.0 - theta) * elt.IntegrationPhi(dof_i, internal.source_at_gp);
+            implicit_weight * elt.IntegrationPhi(dof_i, internal.source_at_gp);
     }
 }
 }
@@ -13,24 +13,72 @@ void Problem::init_volume_kernel(const ProblemStepperType& stepper, ElementType&
     auto& state_next = elt.data.state[stage + 1];
     auto& internal   = elt.data.internal;
 
-    // Initial guess of state
-    state_next.q = state_prev.q;
+    // at the first stage the last state holds the state at the previous time level
+    auto& state_nm1 = elt.data.state[stepper.GetNumStages()];
 
     internal.q_at_gp      = elt.ComputeUgp(state_prev.q);
-    internal.q_prev_at_gp = internal.q_at_gp;
+    internal.q_prev_at_gp = elt.ComputeUgp(elt.data.state[0].q);
+
+    if (stepper.GetHistoryWeight() != 0.0) {
+        internal.q_prev_at_gp += stepper.GetHistoryWeight() * (internal.q_prev_at_gp - elt.ComputeUgp(state_nm1.q));
+    }
+
+    // Initial guess of state, extrapolated in time at the first stage if a predictor is used
+    const uint order = stage == 0 ? std::min(SWE::GlobalProblem::predictor_order, stepper.GetStep()) : 0;
+
+    if (order == 0) {
+        state_next.q = state_prev.q;
+    } else if (order == 1) {
+        if (SWE::GlobalProblem::predictor_order == 2) {
+            internal.q_nm2 = state_nm1.q;
+        }
+
+        state_next.q = 2.0 * state_prev.q - state_nm1.q;
+    } else {
+        // q_pred = 3 * q_n - 3 * q_nm1 + q_nm2, afterwards q_nm2 <- q_nm1
+        internal.q_nm2 += 3.0 * (state_prev.q - state_nm1.q);
+        std::swap(internal.q_nm2, state_next.q);
+
+        if (stepper.GetNumStages() != 1) {
+            internal.q_nm2 = state_nm1.q;
+        }
+    }
 
     set_constant(internal.rhs_prev, 0.0);
 
-    if (stepper.GetOrder() == 2) {
+    if (stepper.StageRHSRequired()) {
         row(internal.aux_at_gp, SWE::Auxiliaries::h) =
             row(internal.q_at_gp, SWE::Variables::ze) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
 
-        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, internal.Fx_at_gp, internal.Fy_at_gp);
+        auto& scratch = SWE::volume_scratch(elt.data.get_ngp_internal());
+
+        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, scratch.Fx, scratch.Fy);
 
         for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
             subvector(internal.rhs_prev, SWE::n_variables * dof_i, SWE::n_variables) =
-                elt.IntegrationDPhi(GlobalCoord::x, dof_i, internal.Fx_at_gp) +
-                elt.IntegrationDPhi(GlobalCoord::y, dof_i, internal.Fy_at_gp);
+                elt.IntegrationDPhi(GlobalCoord::x, dof_i, scratch.Fx) +
+                elt.IntegrationDPhi(GlobalCoord::y, dof_i, scratch.Fy);
+        }
+    }
+}
+
+template <typename ElementType>
+void Problem::init_stage_rhs_kernel(const ProblemStepperType& stepper, ElementType& elt) {
+    const uint stage = stepper.GetStage();
+
+    auto& internal = elt.data.internal;
+
+    // rhs_prev holds the residual at the state of the current stage, which is kept for later stages,
+    // and is replaced by the weighted sum of residuals at the states of all previous stages
+    if (stage + 1 < stepper.GetNumStages()) {
+        internal.rhs_stages[stage] = internal.rhs_prev;
+    }
+
+    internal.rhs_prev *= stepper.GetExplicitWeight(stage);
+
+    for (uint stage_j = 0; stage_j < stage; ++stage_j) {
+        if (stepper.GetExplicitWeight(stage_j) != 0.0) {
+            internal.rhs_prev += stepper.GetExplicitWeight(stage_j) * internal.rhs_stages[stage_j];
         }
     }
 }
@@ -47,7 +95,9 @@ void Problem::local_volume_kernel(const ProblemStepperType& stepper, ElementType
     row(internal.aux_at_gp, SWE::Auxiliaries::h) =
         row(internal.q_at_gp, SWE::Variables::ze) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
 
-    SWE::get_F(internal.q_at_gp, internal.aux_at_gp, internal.Fx_at_gp, internal.Fy_at_gp);
+    auto& scratch = SWE::volume_scratch(elt.data.get_ngp_internal());
+
+    SWE::get_F(internal.q_at_gp, internal.aux_at_gp, scratch.Fx, scratch.Fy);
 
     // del_q / DT
     internal.del_q_DT_at_gp = (internal.q_at_gp - internal.q_prev_at_gp) / stepper.GetDT();
@@ -59,7 +109,7 @@ void Problem::local_volume_kernel(const ProblemStepperType& stepper, ElementType
         column(internal.kronecker_DT_at_gp, gp) = IdentityVector<double>(SWE::n_variables) / stepper.GetDT();
     }
 
-    double theta = stepper.GetTheta();
+    const double implicit_weight = stepper.GetImplicitWeight();
 
     for (uint dof_i = 0; dof_i < elt.data.get_ndof(); ++dof_i) {
         for (uint dof_j = 0; dof_j < elt.data.get_ndof(); ++dof_j) {
@@ -70,17 +120,17 @@ void Problem::local_volume_kernel(const ProblemStepperType& stepper, ElementType
                       SWE::n_variables) =
                 reshape<double, SWE::n_variables>(
                     elt.IntegrationPhiPhi(dof_j, dof_i, internal.kronecker_DT_at_gp) -
-                    (1.0 - theta) * elt.IntegrationPhiDPhi(dof_j, GlobalCoord::x, dof_i, internal.dFx_dq_at_gp) -
-                    (1.0 - theta) * elt.IntegrationPhiDPhi(dof_j, GlobalCoord::y, dof_i, internal.dFy_dq_at_gp));
+                    implicit_weight * elt.IntegrationPhiDPhi(dof_j, GlobalCoord::x, dof_i, internal.dFx_dq_at_gp) -
+                    implicit_weight * elt.IntegrationPhiDPhi(dof_j, GlobalCoord::y, dof_i, internal.dFy_dq_at_gp));
         }
 
         subvector(internal.rhs_local, SWE::n_variables * dof_i, SWE::n_variables) =
             -elt.IntegrationPhi(dof_i, internal.del_q_DT_at_gp) +
-            (1.0 - theta) * elt.IntegrationDPhi(GlobalCoord::x, dof_i, internal.Fx_at_gp) +
-            (1.0 - theta) * elt.IntegrationDPhi(GlobalCoord::y, dof_i, internal.Fy_at_gp);
+            implicit_weight * elt.IntegrationDPhi(GlobalCoord::x, dof_i, scratch.Fx) +
+            implicit_weight * elt.IntegrationDPhi(GlobalCoord::y, dof_i, scratch.Fy);
     }
 
-    internal.rhs_local += theta * internal.rhs_prev;
+    internal.rhs_local += internal.rhs_prev;
 }
 }
 }
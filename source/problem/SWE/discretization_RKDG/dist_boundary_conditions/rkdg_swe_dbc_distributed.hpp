@@ -37,11 +37,8 @@ void Distributed::Initialize(DistributedBoundaryType& dbound) {
 
 template <typename DistributedBoundaryType>
 void Distributed::ComputeFlux(DistributedBoundaryType& dbound) {
-    std::vector<double> message;
-
-    message.resize(1 + SWE::n_variables * dbound.data.get_ngp_boundary(dbound.bound_id));
-
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::bound_state, message);
+    auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(
+        CommTypes::bound_state, 1 + SWE::n_variables * dbound.data.get_ngp_boundary(dbound.bound_id));
 
     bool wet_ex = (bool)message[0];
 
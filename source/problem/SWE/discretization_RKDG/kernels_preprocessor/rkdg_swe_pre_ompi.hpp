@@ -38,6 +38,13 @@ void Problem::preprocessor_ompi(std::vector<std::unique_ptr<OMPISimUnitType<Prob
         sim_units[su_id]->discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { elt.data.resize(stepper.GetNumStages() + 1); });
     }
+
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        sim_units[su_id]->stepper = stepper;
+    }
+
+    // from here on sim units are stepped by whichever thread is free
+#pragma omp barrier
 }
 }
 }
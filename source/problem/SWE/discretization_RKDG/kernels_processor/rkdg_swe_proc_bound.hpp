@@ -9,12 +9,12 @@ void Problem::boundary_kernel(const ProblemStepperType& stepper, BoundaryType& b
         auto& state    = bound.data.state[stepper.GetStage()];
         auto& boundary = bound.data.boundary[bound.bound_id];
 
-        boundary.q_at_gp = bound.ComputeUgp(state.q);
+        noalias(boundary.q_at_gp) = bound.ComputeUgp(state.q);
 
         bound.boundary_condition.ComputeFlux(stepper, bound);
 
         // now compute contributions to the righthand side
-        state.rhs -= bound.IntegrationPhi(boundary.F_hat_at_gp);
+        noalias(state.rhs) -= bound.IntegrationPhi(boundary.F_hat_at_gp);
     }
 }
 }
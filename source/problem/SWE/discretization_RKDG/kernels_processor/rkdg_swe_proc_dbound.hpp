@@ -8,33 +8,29 @@ void Problem::distributed_boundary_send_kernel(const ProblemStepperType& stepper
     auto& state    = dbound.data.state[stepper.GetStage()];
     auto& boundary = dbound.data.boundary[dbound.bound_id];
 
-    boundary.q_at_gp = dbound.ComputeUgp(state.q);
+    noalias(boundary.q_at_gp) = dbound.ComputeUgp(state.q);
 
-    // Construct message to exterior state
-    std::vector<double> message;
+    // Construct message to exterior state directly in send buffer
+    // Edges are integrated exactly to order 2p+1, i.e. with p+1 Gauss points, hence the trace is as compact
+    // as the p+1 edge-restricted modal coefficients and is sent as is
+    const uint ngp = dbound.data.get_ngp_boundary(dbound.bound_id);
 
-    message.reserve(1 + SWE::n_variables * dbound.data.get_ngp_boundary(dbound.bound_id));
+    auto message =
+        dbound.boundary_condition.exchanger.GetSendMessage(CommTypes::bound_state, 1 + SWE::n_variables * ngp);
 
-    message.push_back(dbound.data.wet_dry_state.wet);
+    message[0] = dbound.data.wet_dry_state.wet;
 
-    for (uint gp = 0; gp < dbound.data.get_ngp_boundary(dbound.bound_id); ++gp) {
+    for (uint gp = 0; gp < ngp; ++gp) {
         for (uint var = 0; var < SWE::n_variables; ++var) {
-            message.push_back(boundary.q_at_gp(var, gp));
+            message[1 + SWE::n_variables * gp + var] = boundary.q_at_gp(var, gp);
         }
     }
-
-    // Set message to send buffer
-    dbound.boundary_condition.exchanger.SetToSendBuffer(CommTypes::bound_state, message);
 }
 
 template <typename DistributedBoundaryType>
 void Problem::distributed_boundary_kernel(const ProblemStepperType& stepper, DistributedBoundaryType& dbound) {
-    // Get message from exterior state
-    std::vector<double> message;
-
-    message.resize(1);  // just wet/dry state info
-
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(CommTypes::bound_state, message);
+    // Get message from exterior state, just wet/dry state info
+    auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(CommTypes::bound_state, 1);
 
     bool wet_ex = (bool)message[0];
 
@@ -45,7 +41,7 @@ void Problem::distributed_boundary_kernel(const ProblemStepperType& stepper, Dis
         dbound.boundary_condition.ComputeFlux(dbound);
 
         // now compute contributions to the righthand side
-        state.rhs -= dbound.IntegrationPhi(boundary.F_hat_at_gp);
+        noalias(state.rhs) -= dbound.IntegrationPhi(boundary.F_hat_at_gp);
     }
 }
 }
@@ -39,6 +39,14 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { Problem::boundary_kernel(sim_unit->stepper, bound); });
 
+    sim_unit->discretization.mesh.CallForEachInteriorElement([sim_unit](auto& elt) {
+        auto& state = elt.data.state[sim_unit->stepper.GetStage()];
+
+        noalias(state.solution) = elt.ApplyMinv(state.rhs);
+
+        sim_unit->stepper.UpdateState(elt);
+    });
+
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Finished work before receive" << std::endl
                                       << "Starting to wait on receive with timestamp: "
@@ -55,10 +63,10 @@ auto Problem::stage_hpx(HPXSimUnitType* sim_unit) {
         sim_unit->discretization.mesh.CallForEachDistributedBoundary(
             [sim_unit](auto& dbound) { Problem::distributed_boundary_kernel(sim_unit->stepper, dbound); });
 
-        sim_unit->discretization.mesh.CallForEachElement([sim_unit](auto& elt) {
+        sim_unit->discretization.mesh.CallForEachHaloElement([sim_unit](auto& elt) {
             auto& state = elt.data.state[sim_unit->stepper.GetStage()];
 
-            state.solution = elt.ApplyMinv(state.rhs);
+            noalias(state.solution) = elt.ApplyMinv(state.rhs);
 
             sim_unit->stepper.UpdateState(elt);
         });
@@ -12,15 +12,15 @@ void Problem::interface_kernel(const ProblemStepperType& stepper, InterfaceType&
         auto& state_ex    = intface.data_ex.state[stepper.GetStage()];
         auto& boundary_ex = intface.data_ex.boundary[intface.bound_id_ex];
 
-        boundary_in.q_at_gp = intface.ComputeUgpIN(state_in.q);
-        boundary_ex.q_at_gp = intface.ComputeUgpEX(state_ex.q);
+        noalias(boundary_in.q_at_gp) = intface.ComputeUgpIN(state_in.q);
+        noalias(boundary_ex.q_at_gp) = intface.ComputeUgpEX(state_ex.q);
 
         intface.specialization.ComputeFlux(intface);
 
         // now compute contributions to the righthand side
-        state_in.rhs -= intface.IntegrationPhiIN(boundary_in.F_hat_at_gp);
+        noalias(state_in.rhs) -= intface.IntegrationPhiIN(boundary_in.F_hat_at_gp);
 
-        state_ex.rhs -= intface.IntegrationPhiEX(boundary_ex.F_hat_at_gp);
+        noalias(state_ex.rhs) -= intface.IntegrationPhiEX(boundary_ex.F_hat_at_gp);
     }
 }
 }
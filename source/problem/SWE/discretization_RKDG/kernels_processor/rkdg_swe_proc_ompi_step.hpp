@@ -6,131 +6,200 @@
 
 namespace SWE {
 namespace RKDG {
+// Each stage is split into tasks, a task runs once the messages it depends on have arrived:
+//   0: send bound_state, work before receive
+//   1: work after bound_state receive, advance stepper, send baryctr_state
+//   2: work after baryctr_state receive, contribution to global reductions
+//   3: completion of sends, output
+constexpr uint n_stage_tasks_ompi = 4;
+
 template <template <typename> class OMPISimUnitType, typename ProblemType>
 void Problem::step_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>>>& sim_units,
                         typename ProblemType::ProblemGlobalDataType& global_data,
                         ProblemStepperType& stepper,
                         const uint begin_sim_id,
                         const uint end_sim_id) {
-    for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
-        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-            if (sim_units[su_id]->parser.ParsingInput()) {
-                sim_units[su_id]->parser.ParseInput(stepper, sim_units[su_id]->discretization.mesh);
-            }
+    run_tasks_ompi(sim_units,
+                   n_stage_tasks_ompi * stepper.GetNumStages(),
+                   [](OMPISimUnitType<ProblemType>& sim_unit, const uint task) {
+                       return Problem::stage_task_ready_ompi(sim_unit, task % n_stage_tasks_ompi);
+                   },
+                   [](OMPISimUnitType<ProblemType>& sim_unit, const uint task) {
+                       Problem::stage_task_ompi(sim_unit, task % n_stage_tasks_ompi);
+                   });
+
+    // sim units advance their own steppers, the rank's stepper is only kept in sync for post processing
+#pragma omp master
+    {
+        for (uint stage = 0; stage < stepper.GetNumStages(); ++stage) {
+            ++(stepper);
         }
-
-        Problem::stage_ompi(sim_units, global_data, stepper, begin_sim_id, end_sim_id);
     }
+}
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingOutput()) {
-            sim_units[su_id]->writer.WriteOutput(stepper, sim_units[su_id]->discretization.mesh);
-        }
+template <typename OMPISimUnitType>
+bool Problem::stage_task_ready_ompi(OMPISimUnitType& sim_unit, const uint task) {
+    const uint timestamp = sim_unit.stepper.GetTimestamp();
+
+    switch (task) {
+        case 1:
+            return sim_unit.communicator.TestAllReceives(CommTypes::bound_state, timestamp);
+        case 2:
+            return !SWE::PostProcessing::slope_limiting ||
+                   sim_unit.communicator.TestAllReceives(CommTypes::baryctr_state, timestamp);
+        case 3:
+            return sim_unit.communicator.TestAllSends(CommTypes::bound_state, timestamp) &&
+                   (!SWE::PostProcessing::slope_limiting ||
+                    sim_unit.communicator.TestAllSends(CommTypes::baryctr_state, timestamp));
+        default:
+            return true;
     }
 }
 
-template <template <typename> class OMPISimUnitType, typename ProblemType>
-void Problem::stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>>>& sim_units,
-                         typename ProblemType::ProblemGlobalDataType& global_data,
-                         ProblemStepperType& stepper,
-                         const uint begin_sim_id,
-                         const uint end_sim_id) {
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Current (time, stage): (" << stepper.GetTimeAtCurrentStage()
-                                                  << ',' << stepper.GetStage() << ')' << std::endl;
-
-            sim_units[su_id]->writer.GetLogFile() << "Exchanging data" << std::endl;
+template <typename OMPISimUnitType>
+void Problem::stage_task_ompi(OMPISimUnitType& sim_unit, const uint task) {
+    auto& stepper = sim_unit.stepper;
+
+    if (task == 0) {
+        if (sim_unit.parser.ParsingInput()) {
+            sim_unit.parser.ParseInput(stepper, sim_unit.discretization.mesh);
+        }
+
+        if (sim_unit.writer.WritingVerboseLog()) {
+            sim_unit.writer.GetLogFile() << "Current (time, stage): (" << stepper.GetTimeAtCurrentStage() << ','
+                                         << stepper.GetStage() << ')' << std::endl;
+
+            sim_unit.writer.GetLogFile() << "Exchanging data" << std::endl;
         }
 
-        sim_units[su_id]->communicator.ReceiveAll(CommTypes::bound_state, stepper.GetTimestamp());
+        sim_unit.communicator.ReceiveAll(CommTypes::bound_state, stepper.GetTimestamp());
 
-        sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
+        sim_unit.discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::distributed_boundary_send_kernel(stepper, dbound); });
 
-        sim_units[su_id]->communicator.SendAll(CommTypes::bound_state, stepper.GetTimestamp());
-    }
+        sim_unit.communicator.SendAll(CommTypes::bound_state, stepper.GetTimestamp());
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Starting work before receive" << std::endl;
+        if (sim_unit.writer.WritingVerboseLog()) {
+            sim_unit.writer.GetLogFile() << "Starting work before receive" << std::endl;
         }
 
-        sim_units[su_id]->discretization.mesh.CallForEachElement(
+        sim_unit.discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::volume_kernel(stepper, elt); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachElement(
+        sim_unit.discretization.mesh.CallForEachElement(
             [&stepper](auto& elt) { Problem::source_kernel(stepper, elt); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachInterface(
+        sim_unit.discretization.mesh.CallForEachInterface(
             [&stepper](auto& intface) { Problem::interface_kernel(stepper, intface); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachBoundary(
+        sim_unit.discretization.mesh.CallForEachBoundary(
             [&stepper](auto& bound) { Problem::boundary_kernel(stepper, bound); });
 
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Finished work before receive" << std::endl;
-        }
-    }
+        sim_unit.discretization.mesh.CallForEachInteriorElement([&stepper](auto& elt) {
+            auto& state = elt.data.state[stepper.GetStage()];
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile()
-                << "Starting to wait on receive with timestamp: " << stepper.GetTimestamp() << std::endl;
-        }
+            noalias(state.solution) = elt.ApplyMinv(state.rhs);
 
-        sim_units[su_id]->communicator.WaitAllReceives(CommTypes::bound_state, stepper.GetTimestamp());
+            stepper.UpdateState(elt);
+        });
 
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Starting work after receive" << std::endl;
+        if (sim_unit.writer.WritingVerboseLog()) {
+            sim_unit.writer.GetLogFile() << "Finished work before receive" << std::endl;
+        }
+    } else if (task == 1) {
+        if (sim_unit.writer.WritingVerboseLog()) {
+            sim_unit.writer.GetLogFile() << "Starting work after receive" << std::endl;
         }
 
-        sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary(
+        sim_unit.discretization.mesh.CallForEachDistributedBoundary(
             [&stepper](auto& dbound) { Problem::distributed_boundary_kernel(stepper, dbound); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
+        sim_unit.discretization.mesh.CallForEachHaloElement([&stepper](auto& elt) {
             auto& state = elt.data.state[stepper.GetStage()];
 
-            state.solution = elt.ApplyMinv(state.rhs);
+            noalias(state.solution) = elt.ApplyMinv(state.rhs);
 
             stepper.UpdateState(elt);
         });
 
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Finished work after receive" << std::endl << std::endl;
+        if (sim_unit.writer.WritingVerboseLog()) {
+            sim_unit.writer.GetLogFile() << "Finished work after receive" << std::endl << std::endl;
         }
-    }
 
-#pragma omp barrier
-#pragma omp master
-    { ++(stepper); }
-#pragma omp barrier
+        ++(stepper);
 
-    if (SWE::PostProcessing::wetting_drying) {
-        for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-            sim_units[su_id]->discretization.mesh.CallForEachElement(
+        if (SWE::PostProcessing::wetting_drying) {
+            sim_unit.discretization.mesh.CallForEachElement(
                 [&stepper](auto& elt) { wetting_drying_kernel(stepper, elt); });
         }
-    }
 
-    if (SWE::PostProcessing::slope_limiting) {
-        CS_slope_limiter_ompi(stepper, sim_units, begin_sim_id, end_sim_id, CommTypes::baryctr_state);
-    }
+        if (SWE::PostProcessing::slope_limiting) {
+            CS_slope_limiter_ompi_send(stepper, sim_unit, CommTypes::baryctr_state);
+
+            CS_slope_limiter_ompi_interior(stepper, sim_unit);
+        }
+    } else if (task == 2) {
+        if (SWE::PostProcessing::slope_limiting) {
+            CS_slope_limiter_ompi_halo(stepper, sim_unit, CommTypes::baryctr_state);
+        }
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->discretization.mesh.CallForEachElement([&stepper](auto& elt) {
-            bool nan_found = SWE::scrutinize_solution(stepper, elt);
+        bool nan_found = false;
 
-            if (nan_found)
-                MPI_Abort(MPI_COMM_WORLD, 0);
+        sim_unit.discretization.mesh.CallForEachElement([&stepper, &nan_found](auto& elt) {
+            if (!nan_found) {
+                nan_found = SWE::scrutinize_solution(stepper, elt);
+            }
         });
+
+        if (nan_found) {
+            sim_unit.reducer->Contribute(Reductions::nan_found, 1.0);
+        }
+
+        if (stepper.GetStage() == 0) {
+            double water_volume = 0.0;
+
+            sim_unit.discretization.mesh.CallForEachElement(
+                [&water_volume](auto& elt) { water_volume += SWE::compute_water_volume(elt); });
+
+            sim_unit.reducer->Contribute(Reductions::water_volume, water_volume);
+
+            sim_unit.reducer->Arrive();
+        }
+    } else if (task == 3) {
+        if (stepper.GetStage() == 0 && sim_unit.writer.WritingOutput()) {
+            sim_unit.writer.WriteOutput(stepper, sim_unit.discretization.mesh);
+        }
+    }
+}
+
+template <typename OMPIReducerType>
+void Problem::initialize_reductions_ompi(OMPIReducerType& reducer) {
+    reducer.AddScalar(ReductionOp::max);  // nan_found
+    reducer.AddScalar(ReductionOp::sum);  // water_volume
+}
+
+inline void Problem::monitor_reductions_ompi(const std::vector<double>& first_result,
+                                             const std::vector<double>& result,
+                                             const bool last_round) {
+    int locality_id;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+
+    if (result[Reductions::nan_found] > 0.0) {
+        if (locality_id == 0) {
+            std::cerr << "Fatal Error: found isnan in the solution\n";
+        }
+
+        MPI_Abort(MPI_COMM_WORLD, 0);
     }
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        sim_units[su_id]->communicator.WaitAllSends(CommTypes::bound_state, stepper.GetTimestamp());
+    if (last_round && locality_id == 0) {
+        std::cout << "Relative change in water volume: " << std::setprecision(15)
+                  << (result[Reductions::water_volume] - first_result[Reductions::water_volume]) /
+                         first_result[Reductions::water_volume]
+                  << std::endl;
     }
 }
 }
 }
 
-#endif
\ No newline at end of file
+#endif
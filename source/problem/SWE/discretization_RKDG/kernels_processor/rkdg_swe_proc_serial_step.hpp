@@ -41,7 +41,7 @@ void Problem::stage_serial(DiscretizationType<ProblemType>& discretization,
     discretization.mesh.CallForEachElement([&stepper](auto& elt) {
         auto& state = elt.data.state[stepper.GetStage()];
 
-        state.solution = elt.ApplyMinv(state.rhs);
+        noalias(state.solution) = elt.ApplyMinv(state.rhs);
 
         stepper.UpdateState(elt);
     });
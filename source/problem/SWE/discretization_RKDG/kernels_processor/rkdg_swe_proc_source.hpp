@@ -13,7 +13,7 @@ void Problem::source_kernel(const ProblemStepperType& stepper, ElementType& elt)
 
         SWE::get_source(stepper.GetTimeAtCurrentStage(), elt);
 
-        state.rhs += elt.IntegrationPhi(internal.source_at_gp);
+        noalias(state.rhs) += elt.IntegrationPhi(internal.source_at_gp);
     }
 }
 }
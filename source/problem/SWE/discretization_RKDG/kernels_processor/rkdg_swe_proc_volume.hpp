@@ -14,23 +14,48 @@ void Problem::volume_kernel(const ProblemStepperType& stepper, ElementType& elt)
     if (elt.data.wet_dry_state.wet) {
         auto& internal = elt.data.internal;
 
-        internal.q_at_gp = elt.ComputeUgp(state.q);
+        noalias(internal.q_at_gp) = elt.ComputeUgp(state.q);
 
         row(internal.aux_at_gp, SWE::Auxiliaries::h) =
             row(internal.q_at_gp, SWE::Variables::ze) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
 
-        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, internal.Fx_at_gp, internal.Fy_at_gp);
+#ifdef QUADRATURE_FREE_FLUX
+        // q_at_gp is still needed by the source kernel, the fluxes are interpolated from the nodal points instead
+        auto& scratch = SWE::volume_scratch(elt.data.get_ndof());
+
+        noalias(scratch.q) = elt.ComputeUnodal(state.q);
+
+        row(internal.aux_at_nodes, SWE::Auxiliaries::h) =
+            row(scratch.q, SWE::Variables::ze) + row(internal.aux_at_nodes, SWE::Auxiliaries::bath);
+
+        SWE::get_F(scratch.q, internal.aux_at_nodes, scratch.Fx, scratch.Fy);
 
         // Spherical projection
-        row(internal.Fx_at_gp, SWE::Variables::ze) =
-            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(internal.Fx_at_gp, SWE::Variables::ze));
-        row(internal.Fx_at_gp, SWE::Variables::qx) =
-            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(internal.Fx_at_gp, SWE::Variables::qx));
-        row(internal.Fx_at_gp, SWE::Variables::qy) =
-            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(internal.Fx_at_gp, SWE::Variables::qy));
-
-        state.rhs = elt.IntegrationDPhi(GlobalCoord::x, internal.Fx_at_gp) +
-                    elt.IntegrationDPhi(GlobalCoord::y, internal.Fy_at_gp);
+        row(scratch.Fx, SWE::Variables::ze) =
+            vec_cw_mult(row(internal.aux_at_nodes, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::ze));
+        row(scratch.Fx, SWE::Variables::qx) =
+            vec_cw_mult(row(internal.aux_at_nodes, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::qx));
+        row(scratch.Fx, SWE::Variables::qy) =
+            vec_cw_mult(row(internal.aux_at_nodes, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::qy));
+
+        noalias(state.rhs) = elt.IntegrationNodalDPhi(GlobalCoord::x, scratch.Fx);
+        noalias(state.rhs) += elt.IntegrationNodalDPhi(GlobalCoord::y, scratch.Fy);
+#else
+        auto& scratch = SWE::volume_scratch(elt.data.get_ngp_internal());
+
+        SWE::get_F(internal.q_at_gp, internal.aux_at_gp, scratch.Fx, scratch.Fy);
+
+        // Spherical projection
+        row(scratch.Fx, SWE::Variables::ze) =
+            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::ze));
+        row(scratch.Fx, SWE::Variables::qx) =
+            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::qx));
+        row(scratch.Fx, SWE::Variables::qy) =
+            vec_cw_mult(row(internal.aux_at_gp, SWE::Auxiliaries::sp), row(scratch.Fx, SWE::Variables::qy));
+
+        noalias(state.rhs) = elt.IntegrationDPhi(GlobalCoord::x, scratch.Fx);
+        noalias(state.rhs) += elt.IntegrationDPhi(GlobalCoord::y, scratch.Fy);
+#endif
     }
 }
 }
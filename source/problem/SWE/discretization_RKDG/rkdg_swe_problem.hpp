@@ -78,37 +78,38 @@ struct Problem {
         return offset;
     }
 
-    template <typename RawBoundaryType>
-    static void create_interfaces(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    // communications that may be sent in single precision, i.e. traces of the state
+    static std::vector<uint> single_precision_comms() { return {CommTypes::bound_state}; }
+
+    template <typename RawBoundaryTableType>
+    static void create_interfaces(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_interfaces<SWE::RKDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+    template <typename RawBoundaryTableType>
+    static void create_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                   ProblemMeshType& mesh,
                                   ProblemInputType& input,
                                   ProblemWriterType& writer) {
         SWE::create_boundaries<SWE::RKDG::Problem>(raw_boundaries, mesh, input, writer);
     }
 
-    template <typename RawBoundaryType>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType&,
-        ProblemInputType& problem_input,
-        std::tuple<>&,
-        ProblemWriterType&) {}
-
-    template <typename RawBoundaryType, typename Communicator>
-    static void create_distributed_boundaries(
-        std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
-        ProblemMeshType& mesh,
-        ProblemInputType& input,
-        Communicator& communicator,
-        ProblemWriterType& writer) {
+    template <typename RawBoundaryTableType>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType&,
+                                              ProblemInputType& problem_input,
+                                              std::tuple<>&,
+                                              ProblemWriterType&) {}
+
+    template <typename RawBoundaryTableType, typename Communicator>
+    static void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
+                                              ProblemMeshType& mesh,
+                                              ProblemInputType& input,
+                                              Communicator& communicator,
+                                              ProblemWriterType& writer) {
         // *** //
         SWE::create_distributed_boundaries<SWE::RKDG::Problem>(raw_boundaries, mesh, input, communicator, writer);
     }
@@ -149,12 +150,18 @@ struct Problem {
                           const uint begin_sim_id,
                           const uint end_sim_id);
 
-    template <template <typename> class OMPISimUnitType, typename ProblemType>
-    static void stage_ompi(std::vector<std::unique_ptr<OMPISimUnitType<ProblemType>>>& sim_units,
-                           typename ProblemType::ProblemGlobalDataType& global_data,
-                           ProblemStepperType& stepper,
-                           const uint begin_sim_id,
-                           const uint end_sim_id);
+    template <typename OMPISimUnitType>
+    static bool stage_task_ready_ompi(OMPISimUnitType& sim_unit, const uint task);
+
+    template <typename OMPISimUnitType>
+    static void stage_task_ompi(OMPISimUnitType& sim_unit, const uint task);
+
+    template <typename OMPIReducerType>
+    static void initialize_reductions_ompi(OMPIReducerType& reducer);
+
+    static void monitor_reductions_ompi(const std::vector<double>& first_result,
+                                        const std::vector<double>& result,
+                                        const bool last_round);
 
     template <typename HPXSimUnitType>
     static auto stage_hpx(HPXSimUnitType* sim_unit);
@@ -198,6 +205,17 @@ struct Problem {
     }
 
     static void finalize_simulation(ProblemGlobalDataType& global_data) {}
+
+    // submeshes may move between ranks of the OpenMP+MPI driver, see OMPISimulation::Repartition
+    static constexpr bool ompi_repartitioning = true;
+
+    static void pack_state(ProblemMeshType& mesh, std::vector<double>& buffer) { SWE::pack_state(mesh, buffer); }
+
+    static void unpack_state(ProblemMeshType& mesh, const std::vector<double>& buffer) {
+        SWE::unpack_state(mesh, buffer);
+    }
+
+    static uint count_wet_elements(ProblemMeshType& mesh) { return SWE::count_wet_elements(mesh); }
 };
 }
 }
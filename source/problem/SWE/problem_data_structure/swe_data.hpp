@@ -8,12 +8,15 @@
 #include "swe_data_source.hpp"
 #include "swe_data_wet_dry.hpp"
 #include "swe_data_slope_limit.hpp"
+#include "swe_data_scratch.hpp"
 
 namespace SWE {
-struct Data {
+// Element data, with the per Gauss point arrays of the element and its boundaries given by the discretization
+template <typename InternalType, typename BoundaryType>
+struct DataLayout {
     AlignedVector<SWE::State> state;
-    SWE::Internal internal;
-    AlignedVector<SWE::Boundary> boundary;
+    InternalType internal;
+    AlignedVector<BoundaryType> boundary;
 
     SWE::Source source;
     SWE::WetDry wet_dry_state;
@@ -22,10 +25,14 @@ struct Data {
     void initialize() {
         this->state.emplace_back(this->ndof);
 
-        this->internal = SWE::Internal(this->ngp_internal);
+#ifdef QUADRATURE_FREE_FLUX
+        this->internal = InternalType(this->ngp_internal, this->ndof);
+#else
+        this->internal = InternalType(this->ngp_internal);
+#endif
 
         for (uint bound_id = 0; bound_id < this->nbound; ++bound_id) {
-            this->boundary.push_back(SWE::Boundary(this->ngp_boundary[bound_id]));
+            this->boundary.push_back(BoundaryType(this->ngp_boundary[bound_id]));
         }
 
         this->source = SWE::Source(this->nnode);
@@ -89,6 +96,9 @@ struct Data {
     }
 #endif
 };
+
+// explicit schemes (RKDG, EHDG) share a layout without the Jacobians of the implicit one
+using Data = DataLayout<SWE::Internal, SWE::Boundary>;
 }
 
 #endif
@@ -0,0 +1,67 @@
+#ifndef SWE_DATA_IHDG_HPP
+#define SWE_DATA_IHDG_HPP
+
+#include "swe_data.hpp"
+
+namespace SWE {
+namespace IHDG {
+// Jacobians and local systems of the implicit scheme, only allocated for the IHDG discretization
+struct Internal : SWE::Internal {
+    Internal() = default;
+    Internal(const uint ngp)
+        : SWE::Internal(ngp),
+          q_prev_at_gp(SWE::n_variables, ngp),
+          del_q_DT_at_gp(SWE::n_variables, ngp),
+          kronecker_DT_at_gp(SWE::n_variables * SWE::n_variables, ngp),
+          dFx_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp),
+          dFy_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp),
+          dsource_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp) {}
+
+#ifdef QUADRATURE_FREE_FLUX
+    // volume fluxes of the implicit scheme are always evaluated at the Gauss points
+    Internal(const uint ngp, const uint) : Internal(ngp) {}
+#endif
+
+    HybMatrix<double, SWE::n_variables> q_prev_at_gp;
+    HybMatrix<double, SWE::n_variables> del_q_DT_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> kronecker_DT_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> dFx_dq_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> dFy_dq_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> dsource_dq_at_gp;
+
+    DynMatrix<double> delta_local_inv;
+    DynMatrix<double> delta_local;
+    DynVector<double> rhs_local;
+    DynVector<double> rhs_prev;
+    // residuals at the states of previous stages, only stored for multistage implicit methods
+    std::vector<DynVector<double>> rhs_stages;
+
+    DynVector<double> del_q_local;
+
+    // state two time levels back, only stored for the quadratic predictor
+    HybMatrix<double, SWE::n_variables> q_nm2;
+};
+
+struct Boundary : SWE::Boundary {
+    Boundary() = default;
+    Boundary(const uint ngp)
+        : SWE::Boundary(ngp),
+          dF_hat_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp),
+          dF_hat_dq_hat_at_gp(SWE::n_variables * SWE::n_variables, ngp),
+          delta_global_kernel_at_gp(SWE::n_variables * SWE::n_variables, ngp) {}
+
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> dF_hat_dq_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> dF_hat_dq_hat_at_gp;
+    HybMatrix<double, SWE::n_variables * SWE::n_variables> delta_global_kernel_at_gp;
+
+    DynMatrix<double> delta_global;
+    DynMatrix<double> delta_hat_local;
+
+    std::vector<uint> global_dof_indx;
+};
+
+using Data = SWE::DataLayout<IHDG::Internal, IHDG::Boundary>;
+}
+}
+
+#endif
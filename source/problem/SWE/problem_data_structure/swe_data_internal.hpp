@@ -7,43 +7,31 @@ struct Internal {
     Internal(const uint ngp)
         : q_at_gp(SWE::n_variables, ngp),
           aux_at_gp(SWE::n_auxiliaries, ngp),
-          Fx_at_gp(SWE::n_variables, ngp),
-          Fy_at_gp(SWE::n_variables, ngp),
           source_at_gp(SWE::n_variables, ngp),
           dbath_at_gp(SWE::n_dimensions, ngp),
           tau_s_at_gp(SWE::n_dimensions, ngp),
           dp_atm_at_gp(SWE::n_dimensions, ngp),
-          dtide_pot_at_gp(SWE::n_dimensions, ngp),
-          q_prev_at_gp(SWE::n_variables, ngp),
-          del_q_DT_at_gp(SWE::n_variables, ngp),
-          kronecker_DT_at_gp(SWE::n_variables * SWE::n_variables, ngp),
-          dFx_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp),
-          dFy_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp),
-          dsource_dq_at_gp(SWE::n_variables * SWE::n_variables, ngp) {}
+          dtide_pot_at_gp(SWE::n_dimensions, ngp) {}
+
+#ifdef QUADRATURE_FREE_FLUX
+    Internal(const uint ngp, const uint nnodal) : Internal(ngp) {
+        this->aux_at_nodes = HybMatrix<double, SWE::n_auxiliaries>(SWE::n_auxiliaries, nnodal);
+    }
+#endif
 
     HybMatrix<double, SWE::n_variables> q_at_gp;
     HybMatrix<double, SWE::n_auxiliaries> aux_at_gp;
 
-    HybMatrix<double, SWE::n_variables> Fx_at_gp;
-    HybMatrix<double, SWE::n_variables> Fy_at_gp;
-
     HybMatrix<double, SWE::n_variables> source_at_gp;
     HybMatrix<double, SWE::n_dimensions> dbath_at_gp;
     HybMatrix<double, SWE::n_dimensions> tau_s_at_gp;
     HybMatrix<double, SWE::n_dimensions> dp_atm_at_gp;
     HybMatrix<double, SWE::n_dimensions> dtide_pot_at_gp;
 
-    HybMatrix<double, SWE::n_variables> q_prev_at_gp;
-    HybMatrix<double, SWE::n_variables> del_q_DT_at_gp;
-    HybMatrix<double, SWE::n_variables * SWE::n_variables> kronecker_DT_at_gp;
-    HybMatrix<double, SWE::n_variables * SWE::n_variables> dFx_dq_at_gp;
-    HybMatrix<double, SWE::n_variables * SWE::n_variables> dFy_dq_at_gp;
-    HybMatrix<double, SWE::n_variables * SWE::n_variables> dsource_dq_at_gp;
-
-    DynMatrix<double> delta_local_inv;
-    DynMatrix<double> delta_local;
-    DynVector<double> rhs_local;
-    DynVector<double> rhs_prev;
+#ifdef QUADRATURE_FREE_FLUX
+    // volume fluxes are collocated at the nodal points of the master element
+    HybMatrix<double, SWE::n_auxiliaries> aux_at_nodes;
+#endif
 
 #ifdef HAS_HPX
     template <typename Archive>
@@ -51,14 +39,15 @@ struct Internal {
         // clang-format off
         ar  & q_at_gp
             & aux_at_gp
-            & Fx_at_gp
-            & Fy_at_gp
             & source_at_gp
             & dbath_at_gp
             & tau_s_at_gp
             & dp_atm_at_gp
             & dtide_pot_at_gp;
         // clang-format on
+#ifdef QUADRATURE_FREE_FLUX
+        ar & aux_at_nodes;
+#endif
     }
 #endif
 };
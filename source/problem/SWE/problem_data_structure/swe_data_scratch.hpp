@@ -0,0 +1,27 @@
+#ifndef SWE_DATA_SCRATCH_HPP
+#define SWE_DATA_SCRATCH_HPP
+
+namespace SWE {
+// Volume fluxes are consumed within the kernel evaluating them, therefore they are kept once per thread
+// rather than once per element
+struct VolumeScratch {
+    HybMatrix<double, SWE::n_variables> q;
+    HybMatrix<double, SWE::n_variables> Fx;
+    HybMatrix<double, SWE::n_variables> Fy;
+};
+
+// Returns the calling thread's scratch, sized for npts points
+inline VolumeScratch& volume_scratch(const uint npts) {
+    thread_local VolumeScratch scratch;
+
+    if (columns(scratch.Fx) != npts) {
+        scratch.q  = HybMatrix<double, SWE::n_variables>(SWE::n_variables, npts);
+        scratch.Fx = HybMatrix<double, SWE::n_variables>(SWE::n_variables, npts);
+        scratch.Fy = HybMatrix<double, SWE::n_variables>(SWE::n_variables, npts);
+    }
+
+    return scratch;
+}
+}
+
+#endif
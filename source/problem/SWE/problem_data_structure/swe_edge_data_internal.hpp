@@ -30,9 +30,15 @@ struct EdgeInternal {
     DynMatrix<double, SO::ColumnMajor> delta_hat_global;
     DynVector<double> rhs_global;
 
+    DynMatrix<double> delta_hat_global_inv;
+
     DynVector<double> delta_hat_global_flat;
     std::vector<DynVector<double>> delta_hat_global_con_flat;
 
+    // trace states at previous time levels, only stored if a predictor is used
+    HybMatrix<double, SWE::n_variables> q_hat_nm1;
+    HybMatrix<double, SWE::n_variables> q_hat_nm2;
+
     std::vector<uint> global_dof_indx;
     uint sol_offset;
 };
@@ -25,8 +25,22 @@ struct GlobalData {
     DynVector<double> solution;
     bool converged = false;
 
+    // matrix-free global problem
+    Mat delta_hat_global_precon = nullptr;
+    std::function<void(Vec, Vec)> delta_hat_global_apply;
+
+    static PetscErrorCode apply_matrix_free(Mat A, Vec x, Vec y) {
+        void* apply;
+        MatShellGetContext(A, &apply);
+
+        (*(std::function<void(Vec, Vec)>*)apply)(x, y);
+
+        return 0;
+    }
+
     void destroy() {
         MatDestroy(&delta_hat_global);
+        MatDestroy(&delta_hat_global_precon);
         VecDestroy(&rhs_global);
         KSPDestroy(&ksp);
 
@@ -207,6 +207,60 @@ Inputs::Inputs(YAML::Node& swe_node) {
             std::cerr << malformatted_sl_warning;
         }
     }
+
+    const std::string malformatted_gs_warning("Warning: global solver is mal-formatted. Using default parameters.\n");
+
+    if (YAML::Node gs_node = swe_node["global_solver"]) {
+        if (gs_node["type"]) {
+            std::string gs_string = gs_node["type"].as<std::string>();
+
+            if (gs_string == "Direct") {
+                this->global_solver.type = GlobalSolverType::Direct;
+            } else if (gs_string == "MatrixFree") {
+                this->global_solver.type = GlobalSolverType::MatrixFree;
+
+                if (gs_node["tolerance"]) {
+                    this->global_solver.tolerance = gs_node["tolerance"].as<double>();
+                }
+
+                if (gs_node["max_iterations"]) {
+                    this->global_solver.max_iterations = gs_node["max_iterations"].as<uint>();
+                }
+
+                if (gs_node["restart"]) {
+                    this->global_solver.restart = gs_node["restart"].as<uint>();
+                }
+
+                if (this->global_solver.tolerance <= 0. || this->global_solver.max_iterations == 0 ||
+                    this->global_solver.restart == 0) {
+                    throw std::logic_error("Fatal Error: global solver parameters must be positive!\n");
+                }
+            } else {
+                std::cerr << malformatted_gs_warning;
+            }
+        } else {
+            std::cerr << malformatted_gs_warning;
+        }
+    }
+
+    const std::string malformatted_predictor_warning(
+        "Warning: predictor is mal-formatted. Using default parameters.\n");
+
+    if (YAML::Node predictor_node = swe_node["predictor"]) {
+        if (!predictor_node.IsNull()) {
+            std::string predictor_str = predictor_node.as<std::string>();
+
+            if (predictor_str == "Linear") {
+                this->predictor.type = PredictorType::Linear;
+            } else if (predictor_str == "Quadratic") {
+                this->predictor.type = PredictorType::Quadratic;
+            } else {
+                std::cerr << malformatted_predictor_warning;
+            }
+        } else {
+            std::cerr << malformatted_predictor_warning;
+        }
+    }
 }
 
 void Inputs::read_bcis(const std::string& bcis_file) {
@@ -437,6 +491,31 @@ YAML::Node Inputs::as_yaml_node() {
             break;
     }
 
+    YAML::Node gs_node;
+    switch (this->global_solver.type) {
+        case GlobalSolverType::Direct:
+            break;
+        case GlobalSolverType::MatrixFree:
+            gs_node["type"]           = "MatrixFree";
+            gs_node["tolerance"]      = this->global_solver.tolerance;
+            gs_node["max_iterations"] = this->global_solver.max_iterations;
+            gs_node["restart"]        = this->global_solver.restart;
+
+            ret["global_solver"] = gs_node;
+            break;
+    }
+
+    switch (this->predictor.type) {
+        case PredictorType::None:
+            break;
+        case PredictorType::Linear:
+            ret["predictor"] = "Linear";
+            break;
+        case PredictorType::Quadratic:
+            ret["predictor"] = "Quadratic";
+            break;
+    }
+
     return ret;
 }
 }
\ No newline at end of file
@@ -272,6 +272,39 @@ struct SlopeLimiting {
 #endif
 };
 
+// Problem specific global problem solver information containers
+struct GlobalSolver {
+    GlobalSolverType type = GlobalSolverType::Direct;
+    double tolerance      = 1.0e-10;
+    uint max_iterations   = 1000;
+    uint restart          = 50;
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & type
+            & tolerance
+            & max_iterations
+            & restart;
+        // clang-format on
+    }
+#endif
+};
+
+struct Predictor {
+    PredictorType type = PredictorType::None;
+
+#ifdef HAS_HPX
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned) {
+        // clang-format off
+        ar  & type;
+        // clang-format on
+    }
+#endif
+};
+
 // Problem specific inputs
 struct Inputs {
     std::string name;
@@ -296,6 +329,9 @@ struct Inputs {
     WettingDrying wet_dry;
     SlopeLimiting slope_limit;
 
+    GlobalSolver global_solver;
+    Predictor predictor;
+
     Inputs() = default;
     Inputs(YAML::Node& swe_node);
 
@@ -321,7 +357,9 @@ struct Inputs {
             & tide_potential
             & coriolis
             & wet_dry
-            & slope_limit;
+            & slope_limit
+            & global_solver
+            & predictor;
         // clang-format on
     }
 #endif
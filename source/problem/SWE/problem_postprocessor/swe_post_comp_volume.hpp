@@ -0,0 +1,17 @@
+#ifndef SWE_POST_COMP_VOLUME_HPP
+#define SWE_POST_COMP_VOLUME_HPP
+
+namespace SWE {
+template <typename ElementType>
+double compute_water_volume(ElementType& elt) {
+    auto& state    = elt.data.state[0];
+    auto& internal = elt.data.internal;
+
+    DynRowVector<double> h_at_gp =
+        elt.ComputeUgp(row(state.q, SWE::Variables::ze)) + row(internal.aux_at_gp, SWE::Auxiliaries::bath);
+
+    return elt.Integration(h_at_gp);
+}
+}
+
+#endif
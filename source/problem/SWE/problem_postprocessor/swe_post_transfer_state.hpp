@@ -0,0 +1,65 @@
+#ifndef SWE_POST_TRANSFER_STATE_HPP
+#define SWE_POST_TRANSFER_STATE_HPP
+
+namespace SWE {
+// The state carried over from one time step to the next, i.e. all that is needed to resume the simulation of
+// a mesh which has been rebuilt from its input files
+template <typename MeshType>
+void pack_state(MeshType& mesh, std::vector<double>& buffer) {
+    if (SWE::SourceTerms::meteo_forcing) {
+        throw std::logic_error("Fatal Error: transferring state of meshes with meteo forcing is not supported!\n");
+    }
+
+    buffer.clear();
+
+    mesh.CallForEachElement([&buffer](auto& elt) {
+        auto& q = elt.data.state[0].q;
+
+        for (uint dof = 0; dof < columns(q); ++dof) {
+            for (uint var = 0; var < SWE::n_variables; ++var) {
+                buffer.push_back(q(var, dof));
+            }
+        }
+
+        buffer.push_back(elt.data.wet_dry_state.wet);
+        buffer.push_back(elt.data.wet_dry_state.went_completely_dry);
+    });
+}
+
+template <typename MeshType>
+void unpack_state(MeshType& mesh, const std::vector<double>& buffer) {
+    uint index = 0;
+
+    mesh.CallForEachElement([&buffer, &index](auto& elt) {
+        auto& q = elt.data.state[0].q;
+
+        for (uint dof = 0; dof < columns(q); ++dof) {
+            for (uint var = 0; var < SWE::n_variables; ++var) {
+                q(var, dof) = buffer[index++];
+            }
+        }
+
+        elt.data.wet_dry_state.wet                 = (bool)buffer[index++];
+        elt.data.wet_dry_state.went_completely_dry = (bool)buffer[index++];
+    });
+
+    if (index != buffer.size()) {
+        throw std::logic_error("Fatal Error: transferred state does not match the mesh!\n");
+    }
+}
+
+template <typename MeshType>
+uint count_wet_elements(MeshType& mesh) {
+    uint n_wet = 0;
+
+    mesh.CallForEachElement([&n_wet](auto& elt) {
+        if (elt.data.wet_dry_state.wet) {
+            ++n_wet;
+        }
+    });
+
+    return n_wet;
+}
+}
+
+#endif
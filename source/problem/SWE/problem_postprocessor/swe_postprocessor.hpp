@@ -7,5 +7,7 @@
 #include "swe_post_write_vtu.hpp"
 #include "swe_post_write_modal.hpp"
 #include "swe_post_comp_res_l2.hpp"
+#include "swe_post_comp_volume.hpp"
+#include "swe_post_transfer_state.hpp"
 
 #endif
\ No newline at end of file
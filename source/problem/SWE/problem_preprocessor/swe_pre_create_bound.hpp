@@ -2,8 +2,8 @@
 #define SWE_PRE_CREATE_BOUND_HPP
 
 namespace SWE {
-template <typename ProblemType, typename RawBoundaryType>
-void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+template <typename ProblemType, typename RawBoundaryTableType>
+void create_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                        typename ProblemType::ProblemMeshType& mesh,
                        typename ProblemType::ProblemInputType& problem_input,
                        typename ProblemType::ProblemWriterType& writer) {
@@ -18,15 +18,14 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
         if (it->first == SWE::BoundaryTypes::land) {
             uint n_bound_old_land = mesh.GetNumberBoundaries();
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
-                auto& raw_boundary = itt->second;
+            for (auto& entry : it->second) {
+                auto& raw_boundary = entry.second;
 
                 mesh.template CreateBoundary<BoundaryTypeLand>(std::move(raw_boundary));
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of land boundaries: " << mesh.GetNumberBoundaries() - n_bound_old_land
                                     << std::endl;
@@ -36,9 +35,8 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
             auto& tide_data = problem_input.tide_bc_data;
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
-                auto& raw_boundary = itt->second;
+            for (auto& entry : it->second) {
+                auto& raw_boundary = entry.second;
 
                 std::vector<TideNode> tide;
 
@@ -55,10 +53,10 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
                     throw std::logic_error("Fatal Error: unable to find tide data!\n");
 
                 mesh.template CreateBoundary<BoundaryTypeTide>(std::move(raw_boundary), tide);
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of tide boundaries: " << mesh.GetNumberBoundaries() - n_bound_old_tide
                                     << std::endl;
@@ -68,9 +66,8 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
 
             auto& flow_data = problem_input.flow_bc_data;
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
-                auto& raw_boundary = itt->second;
+            for (auto& entry : it->second) {
+                auto& raw_boundary = entry.second;
 
                 std::vector<FlowNode> flow;
 
@@ -87,10 +84,10 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
                     throw std::logic_error("Fatal Error: unable to find flow data!\n");
 
                 mesh.template CreateBoundary<BoundaryTypeFlow>(std::move(raw_boundary), flow);
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of flow boundaries: " << mesh.GetNumberBoundaries() - n_bound_old_flow
                                     << std::endl;
@@ -98,15 +95,14 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
         } else if (it->first == SWE::BoundaryTypes::function) {
             uint n_bound_old_func = mesh.GetNumberBoundaries();
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
-                auto& raw_boundary = itt->second;
+            for (auto& entry : it->second) {
+                auto& raw_boundary = entry.second;
 
                 mesh.template CreateBoundary<BoundaryTypeFunction>(std::move(raw_boundary));
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of function boundaries: "
                                     << mesh.GetNumberBoundaries() - n_bound_old_func << std::endl;
@@ -114,15 +110,14 @@ void create_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBounda
         } else if (it->first == SWE::BoundaryTypes::outflow) {
             uint n_bound_old_out = mesh.GetNumberBoundaries();
 
-            auto itt = it->second.begin();
-            while (itt != it->second.end()) {
-                auto& raw_boundary = itt->second;
+            for (auto& entry : it->second) {
+                auto& raw_boundary = entry.second;
 
                 mesh.template CreateBoundary<BoundaryTypeOutflow>(std::move(raw_boundary));
-
-                it->second.erase(itt++);
             }
 
+            it->second.clear();
+
             if (writer.WritingLog()) {
                 writer.GetLogFile() << "Number of outflow boundaries: " << mesh.GetNumberBoundaries() - n_bound_old_out
                                     << std::endl;
@@ -2,8 +2,8 @@
 #define SWE_PRE_CREATE_DBOUND_HPP
 
 namespace SWE {
-template <typename ProblemType, typename RawBoundaryType, typename Communicator>
-void create_distributed_boundaries(std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>>& raw_boundaries,
+template <typename ProblemType, typename RawBoundaryTableType, typename Communicator>
+void create_distributed_boundaries(std::map<uchar, RawBoundaryTableType>& raw_boundaries,
                                    typename ProblemType::ProblemMeshType& mesh,
                                    typename ProblemType::ProblemInputType& problem_input,
                                    Communicator& communicator,
@@ -28,6 +28,9 @@ void initialize_data_serial(MeshType& mesh, const ProblemSpecificInputType& prob
             elt.ComputeDUgp(GlobalCoord::x, row(state.aux, SWE::Auxiliaries::bath));
         row(internal.dbath_at_gp, GlobalCoord::y) =
             elt.ComputeDUgp(GlobalCoord::y, row(state.aux, SWE::Auxiliaries::bath));
+#ifdef QUADRATURE_FREE_FLUX
+        row(internal.aux_at_nodes, SWE::Auxiliaries::bath) = elt.ComputeUnodal(row(state.aux, SWE::Auxiliaries::bath));
+#endif
 
         if (problem_specific_input.spherical_projection.type == SWE::SphericalProjectionType::Enable) {
             DynRowVector<double> y_node(nnode);
@@ -42,10 +45,19 @@ void initialize_data_serial(MeshType& mesh, const ProblemSpecificInputType& prob
             for (uint gp = 0; gp < ngp; ++gp) {
                 internal.aux_at_gp(SWE::Auxiliaries::sp, gp) = cos_phi_o / std::cos(y_at_gp[gp] / R);
             }
+#ifdef QUADRATURE_FREE_FLUX
+            DynRowVector<double> y_at_nodes = elt.ComputeUnodal(elt.L2ProjectionNode(y_node));
+            for (uint node = 0; node < columns(y_at_nodes); ++node) {
+                internal.aux_at_nodes(SWE::Auxiliaries::sp, node) = cos_phi_o / std::cos(y_at_nodes[node] / R);
+            }
+#endif
         } else {
             for (uint gp = 0; gp < ngp; ++gp) {
                 internal.aux_at_gp(SWE::Auxiliaries::sp, gp) = 1.0;
             }
+#ifdef QUADRATURE_FREE_FLUX
+            set_constant(row(internal.aux_at_nodes, SWE::Auxiliaries::sp), 1.0);
+#endif
         }
 
         if (problem_specific_input.initial_conditions.type == SWE::InitialConditionsType::Constant ||
@@ -333,11 +345,10 @@ void initialize_data_parallel_pre_send(MeshType& mesh,
         mesh.CallForEachDistributedBoundary([comm_type](auto& dbound) {
             auto& sl_state = dbound.data.slope_limit_state;
 
-            std::vector<double> message(SWE::n_dimensions);
+            auto message = dbound.boundary_condition.exchanger.GetSendMessage(comm_type, SWE::n_dimensions);
             for (uint dim = 0; dim < SWE::n_dimensions; ++dim) {
                 message[dim] = sl_state.baryctr_coord[dim];
             }
-            dbound.boundary_condition.exchanger.SetToSendBuffer(comm_type, message);
         });
     }
 }
@@ -348,8 +359,7 @@ void initialize_data_parallel_post_receive(MeshType& mesh, uint comm_type) {
         mesh.CallForEachDistributedBoundary([comm_type](auto& dbound) {
             auto& sl_state = dbound.data.slope_limit_state;
 
-            std::vector<double> message(SWE::n_dimensions);
-            dbound.boundary_condition.exchanger.GetFromReceiveBuffer(comm_type, message);
+            auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(comm_type, SWE::n_dimensions);
             for (uint dim = 0; dim < SWE::n_dimensions; ++dim) {
                 sl_state.baryctr_coord_neigh[dbound.bound_id][dim] = message[dim];
             }
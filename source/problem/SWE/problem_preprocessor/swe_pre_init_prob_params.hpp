@@ -44,6 +44,20 @@ void initialize_problem_parameters(const SWE::Inputs& problem_specific_input) {
             SWE::PostProcessing::nu = problem_specific_input.slope_limit.nu;
         }
     }
+
+    // specify global problem solver parameters
+    if (problem_specific_input.global_solver.type == SWE::GlobalSolverType::MatrixFree) {
+        SWE::GlobalProblem::matrix_free    = true;
+        SWE::GlobalProblem::tolerance      = problem_specific_input.global_solver.tolerance;
+        SWE::GlobalProblem::max_iterations = problem_specific_input.global_solver.max_iterations;
+        SWE::GlobalProblem::restart        = problem_specific_input.global_solver.restart;
+    }
+
+    if (problem_specific_input.predictor.type == SWE::PredictorType::Linear) {
+        SWE::GlobalProblem::predictor_order = 1;
+    } else if (problem_specific_input.predictor.type == SWE::PredictorType::Quadratic) {
+        SWE::GlobalProblem::predictor_order = 2;
+    }
 }
 }
 
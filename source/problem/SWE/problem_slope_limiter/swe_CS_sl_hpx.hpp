@@ -32,6 +32,9 @@ auto CS_slope_limiter_hpx(HPXSimUnitType* sim_unit, uint comm_type) {
     sim_unit->discretization.mesh.CallForEachBoundary(
         [sim_unit](auto& bound) { slope_limiting_prepare_boundary_kernel(sim_unit->stepper, bound); });
 
+    sim_unit->discretization.mesh.CallForEachInteriorElement(
+        [sim_unit](auto& elt) { slope_limiting_kernel(sim_unit->stepper, elt); });
+
     if (sim_unit->writer.WritingVerboseLog()) {
         sim_unit->writer.GetLogFile() << "Finished slope limiting work before receive" << std::endl
                                       << "Starting to wait on slope limiting receive with timestamp: "
@@ -47,7 +50,7 @@ auto CS_slope_limiter_hpx(HPXSimUnitType* sim_unit, uint comm_type) {
             slope_limiting_prepare_distributed_boundary_kernel(sim_unit->stepper, dbound, comm_type);
         });
 
-        sim_unit->discretization.mesh.CallForEachElement(
+        sim_unit->discretization.mesh.CallForEachHaloElement(
             [sim_unit](auto& elt) { slope_limiting_kernel(sim_unit->stepper, elt); });
 
         if (sim_unit->writer.WritingVerboseLog()) {
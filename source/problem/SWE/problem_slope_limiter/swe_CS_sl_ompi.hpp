@@ -5,43 +5,76 @@
 #include "swe_CS_slope_limiter.hpp"
 
 namespace SWE {
+// Per sim unit parts of the limiter: send baryctr states, limit interior elements, and after the receive
+// has completed limit halo elements
 template <typename StepperType, typename OMPISimUnitType>
-void CS_slope_limiter_ompi(StepperType& stepper,
-                           std::vector<std::unique_ptr<OMPISimUnitType>>& sim_units,
-                           const uint begin_sim_id,
-                           const uint end_sim_id,
-                           uint comm_type) {
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Exchanging slope limiting data" << std::endl;
-        }
+void CS_slope_limiter_ompi_send(const StepperType& stepper, OMPISimUnitType& sim_unit, uint comm_type) {
+    if (sim_unit.writer.WritingVerboseLog()) {
+        sim_unit.writer.GetLogFile() << "Exchanging slope limiting data" << std::endl;
+    }
 
-        sim_units[su_id]->communicator.ReceiveAll(comm_type, stepper.GetTimestamp());
+    sim_unit.communicator.ReceiveAll(comm_type, stepper.GetTimestamp());
 
-        sim_units[su_id]->discretization.mesh.CallForEachElement(
-            [&stepper](auto& elt) { slope_limiting_prepare_element_kernel(stepper, elt); });
+    sim_unit.discretization.mesh.CallForEachElement(
+        [&stepper](auto& elt) { slope_limiting_prepare_element_kernel(stepper, elt); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary([&stepper, comm_type](auto& dbound) {
-            slope_limiting_distributed_boundary_send_kernel(stepper, dbound, comm_type);
-        });
+    sim_unit.discretization.mesh.CallForEachDistributedBoundary([&stepper, comm_type](auto& dbound) {
+        slope_limiting_distributed_boundary_send_kernel(stepper, dbound, comm_type);
+    });
 
-        sim_units[su_id]->communicator.SendAll(comm_type, stepper.GetTimestamp());
+    sim_unit.communicator.SendAll(comm_type, stepper.GetTimestamp());
+}
+
+template <typename StepperType, typename OMPISimUnitType>
+void CS_slope_limiter_ompi_interior(const StepperType& stepper, OMPISimUnitType& sim_unit) {
+    if (sim_unit.writer.WritingVerboseLog()) {
+        sim_unit.writer.GetLogFile() << "Starting slope limiting work before receive" << std::endl;
     }
 
-    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Starting slope limiting work before receive" << std::endl;
-        }
+    sim_unit.discretization.mesh.CallForEachInterface(
+        [&stepper](auto& intface) { slope_limiting_prepare_interface_kernel(stepper, intface); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachInterface(
-            [&stepper](auto& intface) { slope_limiting_prepare_interface_kernel(stepper, intface); });
+    sim_unit.discretization.mesh.CallForEachBoundary(
+        [&stepper](auto& bound) { slope_limiting_prepare_boundary_kernel(stepper, bound); });
 
-        sim_units[su_id]->discretization.mesh.CallForEachBoundary(
-            [&stepper](auto& bound) { slope_limiting_prepare_boundary_kernel(stepper, bound); });
+    sim_unit.discretization.mesh.CallForEachInteriorElement(
+        [&stepper](auto& elt) { slope_limiting_kernel(stepper, elt); });
 
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Finished slope limiting work before receive" << std::endl;
-        }
+    if (sim_unit.writer.WritingVerboseLog()) {
+        sim_unit.writer.GetLogFile() << "Finished slope limiting work before receive" << std::endl;
+    }
+}
+
+template <typename StepperType, typename OMPISimUnitType>
+void CS_slope_limiter_ompi_halo(const StepperType& stepper, OMPISimUnitType& sim_unit, uint comm_type) {
+    if (sim_unit.writer.WritingVerboseLog()) {
+        sim_unit.writer.GetLogFile() << "Starting slope limiting work after receive" << std::endl;
+    }
+
+    sim_unit.discretization.mesh.CallForEachDistributedBoundary([&stepper, comm_type](auto& dbound) {
+        slope_limiting_prepare_distributed_boundary_kernel(stepper, dbound, comm_type);
+    });
+
+    sim_unit.discretization.mesh.CallForEachHaloElement(
+        [&stepper](auto& elt) { slope_limiting_kernel(stepper, elt); });
+
+    if (sim_unit.writer.WritingVerboseLog()) {
+        sim_unit.writer.GetLogFile() << "Finished slope limiting work after receive" << std::endl << std::endl;
+    }
+}
+
+template <typename StepperType, typename OMPISimUnitType>
+void CS_slope_limiter_ompi(StepperType& stepper,
+                           std::vector<std::unique_ptr<OMPISimUnitType>>& sim_units,
+                           const uint begin_sim_id,
+                           const uint end_sim_id,
+                           uint comm_type) {
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        CS_slope_limiter_ompi_send(stepper, *sim_units[su_id], comm_type);
+    }
+
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        CS_slope_limiter_ompi_interior(stepper, *sim_units[su_id]);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
@@ -52,21 +85,7 @@ void CS_slope_limiter_ompi(StepperType& stepper,
 
         sim_units[su_id]->communicator.WaitAllReceives(comm_type, stepper.GetTimestamp());
 
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Starting slope limiting work after receive" << std::endl;
-        }
-
-        sim_units[su_id]->discretization.mesh.CallForEachDistributedBoundary([&stepper, comm_type](auto& dbound) {
-            slope_limiting_prepare_distributed_boundary_kernel(stepper, dbound, comm_type);
-        });
-
-        sim_units[su_id]->discretization.mesh.CallForEachElement(
-            [&stepper](auto& elt) { slope_limiting_kernel(stepper, elt); });
-
-        if (sim_units[su_id]->writer.WritingVerboseLog()) {
-            sim_units[su_id]->writer.GetLogFile() << "Finished slope limiting work after receive" << std::endl
-                                                  << std::endl;
-        }
+        CS_slope_limiter_ompi_halo(stepper, *sim_units[su_id], comm_type);
     }
 
     for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
@@ -75,4 +94,4 @@ void CS_slope_limiter_ompi(StepperType& stepper,
 }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -56,23 +56,18 @@ void slope_limiting_distributed_boundary_send_kernel(const StepperType& stepper,
                                                      uint comm_type) {
     auto& wd_state = dbound.data.wet_dry_state;
 
-    // Construct message to exterior state
-    std::vector<double> message;
+    // Construct message to exterior state directly in send buffer
+    auto message = dbound.boundary_condition.exchanger.GetSendMessage(comm_type, 1 + SWE::n_variables);
 
-    message.reserve(1 + SWE::n_variables);
-
-    message.push_back(wd_state.wet);
+    message[0] = wd_state.wet;
 
     if (wd_state.wet) {
         auto& sl_state = dbound.data.slope_limit_state;
 
         for (uint var = 0; var < SWE::n_variables; ++var) {
-            message.push_back(sl_state.q_at_baryctr[var]);
+            message[1 + var] = sl_state.q_at_baryctr[var];
         }
     }
-
-    // Set message to send buffer
-    dbound.boundary_condition.exchanger.SetToSendBuffer(comm_type, message);
 }
 
 template <typename StepperType, typename DistributedBoundaryType>
@@ -81,11 +76,7 @@ void slope_limiting_prepare_distributed_boundary_kernel(const StepperType& stepp
                                                         uint comm_type) {
     auto& sl_state = dbound.data.slope_limit_state;
 
-    std::vector<double> message;
-
-    message.resize(1 + SWE::n_variables);
-
-    dbound.boundary_condition.exchanger.GetFromReceiveBuffer(comm_type, message);
+    auto message = dbound.boundary_condition.exchanger.GetReceiveMessage(comm_type, 1 + SWE::n_variables);
 
     sl_state.wet_neigh[dbound.bound_id] = message[0];
 
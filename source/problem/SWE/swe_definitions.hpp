@@ -39,6 +39,20 @@ static double nu = 1.5;
 const bool ignored_vars = Utilities::ignore(wetting_drying, slope_limiting, h_o, h_o_threshold, M, nu);
 }
 
+namespace GlobalProblem {
+static bool matrix_free = false;
+
+// GMRES parameters
+static double tolerance    = 1.0e-10;
+static uint max_iterations = 1000;
+static uint restart        = 50;
+
+// order of the extrapolation in time of the initial Newton guess (implicit stepper only)
+static uint predictor_order = 0;
+
+const bool ignored_vars = Utilities::ignore(matrix_free, tolerance, max_iterations, restart, predictor_order);
+}
+
 constexpr uint n_dimensions = 2;
 
 constexpr uint n_variables   = 3;
@@ -71,6 +85,7 @@ enum BoundaryTypes : uchar {
 namespace RKDG {
 constexpr uint n_communications = 3;
 enum CommTypes : uchar { baryctr_coord = 0, bound_state = 1, baryctr_state = 2 };
+enum Reductions : uchar { nan_found = 0, water_volume = 1 };
 }
 
 namespace EHDG {
@@ -100,6 +115,10 @@ enum class CoriolisType { None, Enable };
 enum class WettingDryingType { None, Enable };
 
 enum class SlopeLimitingType { None, CockburnShu };
+
+enum class GlobalSolverType { Direct, MatrixFree };
+
+enum class PredictorType { None, Linear, Quadratic };
 }
 
 #endif
@@ -0,0 +1,282 @@
+#include "../shapes_2D.hpp"
+
+namespace Shape {
+StraightQuadrilateral::StraightQuadrilateral(AlignedVector<Point<3>>&& nodal_coordinates)
+    : Shape<2>(std::move(nodal_coordinates)) {
+    // check if element nodes are ccw, swap if necessary
+    if (this->GetJdet(AlignedVector<Point<2>>(0))[0] < 0) {
+        std::swap(this->nodal_coordinates[1], this->nodal_coordinates[3]);
+    }
+
+    // opposite edges of a parallelogram are equal, otherwise the Jacobian would vary over the element
+    const auto& x = this->nodal_coordinates;
+
+    double diameter =
+        std::hypot(x[2][GlobalCoord::x] - x[0][GlobalCoord::x], x[2][GlobalCoord::y] - x[0][GlobalCoord::y]);
+
+    double skew = std::hypot(x[0][GlobalCoord::x] + x[2][GlobalCoord::x] - x[1][GlobalCoord::x] - x[3][GlobalCoord::x],
+                             x[0][GlobalCoord::y] + x[2][GlobalCoord::y] - x[1][GlobalCoord::y] - x[3][GlobalCoord::y]);
+
+    if (skew > 1.0e-8 * diameter) {
+        throw std::logic_error("Fatal Error: quadrilateral element is not a parallelogram!\n");
+    }
+}
+
+std::vector<uint> StraightQuadrilateral::GetBoundaryNodeID(const uint bound_id,
+                                                           const std::vector<uint>& node_ID) const {
+    std::vector<uint> bound_node_ID(2);
+
+    bound_node_ID[0] = node_ID[bound_id];
+    bound_node_ID[1] = node_ID[(bound_id + 1) % 4];
+
+    return bound_node_ID;
+}
+
+double StraightQuadrilateral::GetArea() const {
+    StatMatrix<double, 2, 2> J = this->GetJ();
+
+    return 4.0 * std::abs(determinant(J));
+}
+
+Point<2> StraightQuadrilateral::GetBarycentricCoordinates() const {
+    Point<2> baryctr_coord{0.0, 0.0};
+
+    for (uint node = 0; node < 4; ++node) {
+        baryctr_coord[GlobalCoord::x] += this->nodal_coordinates[node][GlobalCoord::x] / 4.0;
+        baryctr_coord[GlobalCoord::y] += this->nodal_coordinates[node][GlobalCoord::y] / 4.0;
+    }
+
+    return baryctr_coord;
+}
+
+AlignedVector<Point<2>> StraightQuadrilateral::GetMidpointCoordinates() const {
+    AlignedVector<Point<2>> midpoint_coord(4);
+
+    for (uint midpt = 0; midpt < 4; ++midpt) {
+        midpoint_coord[midpt][GlobalCoord::x] = (this->nodal_coordinates[midpt][GlobalCoord::x] +
+                                                 this->nodal_coordinates[(midpt + 1) % 4][GlobalCoord::x]) /
+                                                2.0;
+
+        midpoint_coord[midpt][GlobalCoord::y] = (this->nodal_coordinates[midpt][GlobalCoord::y] +
+                                                 this->nodal_coordinates[(midpt + 1) % 4][GlobalCoord::y]) /
+                                                2.0;
+    }
+
+    return midpoint_coord;
+}
+
+DynVector<double> StraightQuadrilateral::GetJdet(const AlignedVector<Point<2>>& points) const {
+    DynVector<double> J_det(1);
+
+    StatMatrix<double, 2, 2> J = this->GetJ();
+
+    J_det[0] = determinant(J);
+
+    return J_det;
+}
+
+DynVector<double> StraightQuadrilateral::GetSurfaceJ(const uint bound_id, const AlignedVector<Point<2>>& points) const {
+    DynVector<double> surface_J(1);
+
+    surface_J[0] = std::hypot(this->nodal_coordinates[(bound_id + 1) % 4][GlobalCoord::x] -
+                                  this->nodal_coordinates[bound_id][GlobalCoord::x],
+                              this->nodal_coordinates[(bound_id + 1) % 4][GlobalCoord::y] -
+                                  this->nodal_coordinates[bound_id][GlobalCoord::y]) /
+                   2.0;  // half length for straight edge
+
+    return surface_J;
+}
+
+AlignedVector<StatMatrix<double, 2, 2>> StraightQuadrilateral::GetJinv(const AlignedVector<Point<2>>& points) const {
+    AlignedVector<StatMatrix<double, 2, 2>> J_inv(1);
+
+    StatMatrix<double, 2, 2> J = this->GetJ();
+
+    J_inv[0] = inverse(J);
+
+    return J_inv;
+}
+
+AlignedVector<StatVector<double, 2>> StraightQuadrilateral::GetSurfaceNormal(
+    const uint bound_id,
+    const AlignedVector<Point<2>>& points) const {
+    // *** //
+    AlignedVector<StatVector<double, 2>> surface_normal(1);
+
+    double dx = this->nodal_coordinates[(bound_id + 1) % 4][GlobalCoord::x] -
+                this->nodal_coordinates[bound_id][GlobalCoord::x];
+    double dy = this->nodal_coordinates[(bound_id + 1) % 4][GlobalCoord::y] -
+                this->nodal_coordinates[bound_id][GlobalCoord::y];
+
+    double length = std::hypot(dx, dy);
+
+    surface_normal[0][GlobalCoord::x] = dy / length;
+    surface_normal[0][GlobalCoord::y] = -dx / length;
+
+    return surface_normal;
+}
+
+DynMatrix<double> StraightQuadrilateral::GetPsi(const AlignedVector<Point<2>>& points) const {
+    uint ndof = 4;
+    uint npt  = points.size();
+
+    DynMatrix<double> psi(ndof, npt);
+
+    for (uint pt = 0; pt < npt; ++pt) {
+        double n1 = points[pt][LocalCoordQuad::n1];
+        double n2 = points[pt][LocalCoordQuad::n2];
+
+        psi(0, pt) = (1 - n1) * (1 - n2) / 4;  // N1
+        psi(1, pt) = (1 + n1) * (1 - n2) / 4;  // N2
+        psi(2, pt) = (1 + n1) * (1 + n2) / 4;  // N3
+        psi(3, pt) = (1 - n1) * (1 + n2) / 4;  // N4
+    }
+
+    return psi;
+}
+
+std::array<DynMatrix<double>, 2> StraightQuadrilateral::GetDPsi(const AlignedVector<Point<2>>& points) const {
+    uint ndof = 4;
+    uint npt  = points.size();
+
+    std::array<DynMatrix<double>, 2> dpsi;
+
+    DynMatrix<double> dpsi_dx(ndof, npt);
+    DynMatrix<double> dpsi_dy(ndof, npt);
+
+    StatMatrix<double, 2, 2> J_inv = this->GetJinv(points)[0];
+
+    for (uint pt = 0; pt < npt; ++pt) {
+        double n1 = points[pt][LocalCoordQuad::n1];
+        double n2 = points[pt][LocalCoordQuad::n2];
+
+        std::array<double, 4> dpsi_dn1{-(1 - n2) / 4, (1 - n2) / 4, (1 + n2) / 4, -(1 + n2) / 4};
+        std::array<double, 4> dpsi_dn2{-(1 - n1) / 4, -(1 + n1) / 4, (1 + n1) / 4, (1 - n1) / 4};
+
+        for (uint dof = 0; dof < ndof; ++dof) {
+            dpsi_dx(dof, pt) = dpsi_dn1[dof] * J_inv(LocalCoordQuad::n1, GlobalCoord::x) +
+                               dpsi_dn2[dof] * J_inv(LocalCoordQuad::n2, GlobalCoord::x);
+            dpsi_dy(dof, pt) = dpsi_dn1[dof] * J_inv(LocalCoordQuad::n1, GlobalCoord::y) +
+                               dpsi_dn2[dof] * J_inv(LocalCoordQuad::n2, GlobalCoord::y);
+        }
+    }
+
+    dpsi[GlobalCoord::x] = dpsi_dx;
+    dpsi[GlobalCoord::y] = dpsi_dy;
+
+    return dpsi;
+}
+
+DynMatrix<double> StraightQuadrilateral::GetBoundaryPsi(const uint bound_id,
+                                                        const AlignedVector<Point<1>>& points) const {
+    uint ndof = 2;
+    uint npt  = points.size();
+
+    DynMatrix<double> psi_bound(ndof, npt);
+
+    for (uint pt = 0; pt < npt; ++pt) {
+        psi_bound(0, pt) = (1 - points[pt][LocalCoordLin::l1]) / 2;  // N1
+        psi_bound(1, pt) = (1 + points[pt][LocalCoordLin::l1]) / 2;  // N2
+    }
+
+    return psi_bound;
+}
+
+AlignedVector<Point<2>> StraightQuadrilateral::LocalToGlobalCoordinates(const AlignedVector<Point<2>>& points) const {
+    uint npt = points.size();
+
+    AlignedVector<Point<2>> global_coordinates(npt);
+
+    DynMatrix<double> psi_pts = this->GetPsi(points);
+
+    for (uint pt = 0; pt < npt; ++pt) {
+        global_coordinates[pt][GlobalCoord::x] = 0.0;
+        global_coordinates[pt][GlobalCoord::y] = 0.0;
+
+        for (uint node = 0; node < 4; ++node) {
+            global_coordinates[pt][GlobalCoord::x] += this->nodal_coordinates[node][GlobalCoord::x] * psi_pts(node, pt);
+            global_coordinates[pt][GlobalCoord::y] += this->nodal_coordinates[node][GlobalCoord::y] * psi_pts(node, pt);
+        }
+    }
+
+    return global_coordinates;
+}
+
+AlignedVector<Point<2>> StraightQuadrilateral::GlobalToLocalCoordinates(const AlignedVector<Point<2>>& points) const {
+    uint npt = points.size();
+
+    AlignedVector<Point<2>> local_coordinates(npt);
+
+    StatMatrix<double, 2, 2> J     = this->GetJ();
+    StatMatrix<double, 2, 2> J_inv = inverse(J);
+
+    // the center of a parallelogram is mapped to (0,0)
+    Point<2> center = this->GetBarycentricCoordinates();
+
+    StatVector<double, 2> n;
+
+    for (uint pt = 0; pt < npt; ++pt) {
+        n = (points[pt][GlobalCoord::x] - center[GlobalCoord::x]) * column(J_inv, GlobalCoord::x) +
+            (points[pt][GlobalCoord::y] - center[GlobalCoord::y]) * column(J_inv, GlobalCoord::y);
+
+        local_coordinates[pt][LocalCoordQuad::n1] = n[0];
+        local_coordinates[pt][LocalCoordQuad::n2] = n[1];
+    }
+
+    return local_coordinates;
+}
+
+bool StraightQuadrilateral::ContainsPoint(const Point<2>& point) const {
+    Point<2> n = this->GlobalToLocalCoordinates(AlignedVector<Point<2>>{point})[0];
+
+    if (std::abs(n[LocalCoordQuad::n1]) <= 1.0 && std::abs(n[LocalCoordQuad::n2]) <= 1.0)
+        return true;
+
+    return false;
+}
+
+void StraightQuadrilateral::GetVTK(AlignedVector<Point<3>>& points, Array2D<uint>& cells) const {
+    uint number_pt = points.size();
+
+    double dz = 2.0 / N_DIV;
+
+    AlignedVector<Point<2>> z_vtk;
+
+    for (uint i = 0; i <= N_DIV; ++i) {
+        for (uint j = 0; j <= N_DIV; ++j) {
+            z_vtk.push_back(Point<2>{-1.0 + dz * j, -1.0 + dz * i});
+        }
+    }
+
+    for (const auto& pt : this->LocalToGlobalCoordinates(z_vtk)) {
+        points.push_back(Point<3>{pt[GlobalCoord::x], pt[GlobalCoord::y], 0.0});
+    }
+
+    uint pt_ID;
+
+    for (uint i = 0; i < N_DIV; ++i) {
+        for (uint j = 0; j < N_DIV; ++j) {
+            cells.push_back(std::vector<uint>(5));
+
+            pt_ID = number_pt + (N_DIV + 1) * i + j;
+
+            cells.back()[0] = VTKElementTypes::straight_quadrilateral;
+            cells.back()[1] = pt_ID;
+            cells.back()[2] = pt_ID + 1;
+            cells.back()[3] = pt_ID + (N_DIV + 1) + 1;
+            cells.back()[4] = pt_ID + (N_DIV + 1);
+        }
+    }
+}
+
+StatMatrix<double, 2, 2> StraightQuadrilateral::GetJ() const {
+    StatMatrix<double, 2, 2> J;
+
+    J(0, 0) = (this->nodal_coordinates[1][GlobalCoord::x] - this->nodal_coordinates[0][GlobalCoord::x]) / 2.0;
+    J(0, 1) = (this->nodal_coordinates[3][GlobalCoord::x] - this->nodal_coordinates[0][GlobalCoord::x]) / 2.0;
+    J(1, 0) = (this->nodal_coordinates[1][GlobalCoord::y] - this->nodal_coordinates[0][GlobalCoord::y]) / 2.0;
+    J(1, 1) = (this->nodal_coordinates[3][GlobalCoord::y] - this->nodal_coordinates[0][GlobalCoord::y]) / 2.0;
+
+    return J;
+}
+}
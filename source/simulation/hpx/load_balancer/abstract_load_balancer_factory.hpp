@@ -1,22 +1,22 @@
 #ifndef ABSTRACT_LOAD_BALANCER_FACTORY_HPP
 #define ABSTRACT_LOAD_BALANCER_FACTORY_HPP
 
+#include "preprocessor/input_parameters.hpp"
 #include "base_model.hpp"
+
 namespace LoadBalancer {
 class AbstractFactory {
   public:
-    template <typename ProblemType>
     static hpx::future<void> initialize_locality_and_world_models(const uint locality_id,
-                                                                  const std::string& input_string);
+                                                                  const std::string& input_string,
+                                                                  const LoadBalancerInput& load_balancer_input);
 
-    template <typename ProblemType>
-    static void reset_locality_and_world_models();
+    static void reset_locality_and_world_models(const LoadBalancerInput& load_balancer_input);
 
-    template <typename ProblemType>
     static std::unique_ptr<SubmeshModel> create_submesh_model(uint locality_id,
                                                               uint submesh_id,
                                                               const LoadBalancerInput& load_balancer_input);
 };
 }
 
-#endif
\ No newline at end of file
+#endif
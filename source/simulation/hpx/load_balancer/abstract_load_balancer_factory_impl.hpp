@@ -3,27 +3,46 @@
 
 #include "abstract_load_balancer_factory.hpp"
 #include "random.hpp"
+#include "greedy.hpp"
 
 namespace LoadBalancer {
-template <typename ProblemType>
-hpx::future<void> AbstractFactory::initialize_locality_and_world_models(const uint locality_id,
-                                                                        const std::string& input_string) {
-    return Random<ProblemType>::initialize_locality_and_world_models(locality_id, input_string);
+inline hpx::future<void> AbstractFactory::initialize_locality_and_world_models(
+    const uint locality_id,
+    const std::string& input_string,
+    const LoadBalancerInput& load_balancer_input) {
+    if (load_balancer_input.use_load_balancer) {
+        if (load_balancer_input.name == "random") {
+            return Random::initialize_locality_and_world_models(locality_id, input_string);
+        } else if (load_balancer_input.name == "greedy") {
+            return Greedy::initialize_locality_and_world_models(locality_id, input_string);
+        } else {
+            std::string err_msg{"Error: Unknown load balancer of type: " + load_balancer_input.name};
+            throw std::logic_error(err_msg);
+        }
+    } else {
+        return hpx::make_ready_future();
+    }
 }
 
-template <typename ProblemType>
-void AbstractFactory::reset_locality_and_world_models() {
-    return Random<ProblemType>::reset_locality_and_world_models();
+inline void AbstractFactory::reset_locality_and_world_models(const LoadBalancerInput& load_balancer_input) {
+    if (load_balancer_input.use_load_balancer) {
+        if (load_balancer_input.name == "random") {
+            Random::reset_locality_and_world_models();
+        } else if (load_balancer_input.name == "greedy") {
+            Greedy::reset_locality_and_world_models();
+        }
+    }
 }
 
-template <typename ProblemType>
-std::unique_ptr<SubmeshModel> AbstractFactory::create_submesh_model(uint locality_id,
-                                                                    uint submesh_id,
-                                                                    const LoadBalancerInput& load_balancer_input) {
+inline std::unique_ptr<SubmeshModel> AbstractFactory::create_submesh_model(
+    uint locality_id,
+    uint submesh_id,
+    const LoadBalancerInput& load_balancer_input) {
     if (load_balancer_input.use_load_balancer) {
         if (load_balancer_input.name == "random") {
-            return Random<ProblemType>::create_submesh_model(
-                locality_id, submesh_id, load_balancer_input.rebalance_frequency);
+            return Random::create_submesh_model(locality_id, submesh_id, load_balancer_input.rebalance_frequency);
+        } else if (load_balancer_input.name == "greedy") {
+            return Greedy::create_submesh_model(locality_id, submesh_id, load_balancer_input.rebalance_frequency);
         } else {
             std::string err_msg{"Error: Unknown load balancer of type: " + load_balancer_input.name};
             throw std::logic_error(err_msg);
@@ -34,4 +53,4 @@ std::unique_ptr<SubmeshModel> AbstractFactory::create_submesh_model(uint localit
 }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,273 @@
+#ifndef LOAD_BALANCER_GREEDY_HPP
+#define LOAD_BALANCER_GREEDY_HPP
+
+#include "utilities/heartbeat.hpp"
+#include "utilities/file_exists.hpp"
+#include "preprocessor/input_parameters.hpp"
+#include "base_model.hpp"
+#include "simulation/hpx/sim_unit_hpx_base.hpp"
+
+#include <hpx/include/local_lcos.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace LoadBalancer {
+namespace detail_greedy {
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Collects the measured cost of every submesh and, once all of them reported for the current period, migrates the
+// most expensive submeshes off the most loaded localities
+class WorldModel : public hpx::components::simple_component_base<WorldModel> {
+  public:
+    using ClientType = HPXSimulationUnitClient;
+
+    static constexpr const char* GetBasename() { return "LOAD_BALANCER_GREEDY_WORLD_MODEL"; }
+
+    // relative excess over the mean locality load below which no submesh is moved
+    static constexpr double imbalance_tolerance = 0.1;
+
+    WorldModel() = default;
+    WorldModel(const std::string& input_string);
+
+    void ReportCost(uint locality_id, uint submesh_id, double compute_cost);
+    HPX_DEFINE_COMPONENT_ACTION(WorldModel, ReportCost, ReportCostAction);
+
+  private:
+    void Rebalance();
+
+    struct SubmeshRecord {
+        ClientType client;
+        uint locality_id;
+        double compute_cost = 0.;
+        bool reported       = false;
+    };
+
+    hpx::lcos::local::mutex mutex;
+
+    uint n_localities;
+    uint n_reported = 0;
+
+    std::vector<SubmeshRecord> submeshes;
+    // offset of locality's submeshes in submeshes, with submeshes identified by their initial locality
+    std::vector<uint> locality_offset;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WorldModelClient final : public hpx::components::client_base<WorldModelClient, WorldModel> {
+  private:
+    using BaseType = hpx::components::client_base<WorldModelClient, WorldModel>;
+
+  public:
+    WorldModelClient() = default;
+    WorldModelClient(hpx::future<hpx::id_type>&& id) : BaseType(std::move(id)) {}
+
+    void ReportCost(uint locality_id, uint submesh_id, double compute_cost) {
+        using ActionType = typename WorldModel::ReportCostAction;
+        hpx::apply<ActionType>(this->get_id(), locality_id, submesh_id, compute_cost);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SubmeshModel : public LoadBalancer::SubmeshModel {
+  public:
+    using BaseType = LoadBalancer::SubmeshModel;
+
+    SubmeshModel() = default;
+    SubmeshModel(const std::chrono::duration<double>& rebalance_period, uint locality_id, uint submesh_id);
+
+    void InStep(uint64_t compute_cost, uint64_t memory_cost) override;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned);
+    HPX_SERIALIZATION_POLYMORPHIC(SubmeshModel);
+
+  private:
+    Utilities::HeartBeat beat;
+
+    uint64_t compute_cost = 0;
+    uint n_steps          = 0;
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct Greedy {
+    using SubmeshModel     = detail_greedy::SubmeshModel;
+    using WorldModel       = detail_greedy::WorldModel;
+    using WorldModelClient = detail_greedy::WorldModelClient;
+
+    static WorldModelClient world_model_client;
+    static hpx::future<void> initialize_locality_and_world_models(const uint locality_id,
+                                                                  const std::string& input_string);
+    static void reset_locality_and_world_models();
+    static std::unique_ptr<LoadBalancer::SubmeshModel> create_submesh_model(uint locality_id,
+                                                                            uint submesh_id,
+                                                                            double rebalance_frequency);
+};
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// To be expanded in exactly one translation unit
+#define DGSWEMV2_REGISTER_GREEDY_LOAD_BALANCER()                                                    \
+    LoadBalancer::Greedy::WorldModelClient LoadBalancer::Greedy::world_model_client;                \
+    using grdy_lb_world_model_           = LoadBalancer::Greedy::WorldModel;                        \
+    using grdy_lb_world_model_component_ = hpx::components::simple_component<grdy_lb_world_model_>; \
+    HPX_REGISTER_COMPONENT(grdy_lb_world_model_component_, grdy_lb_world_model_);
+/**/
+namespace LoadBalancer {
+namespace detail_greedy {
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WorldModel Implementation
+inline WorldModel::WorldModel(const std::string& input_string) {
+    InputParameters<> input(input_string);
+
+    this->n_localities = hpx::get_initial_num_localities();
+
+    for (uint locality_id = 0; locality_id < this->n_localities; ++locality_id) {
+        std::string submesh_file_prefix =
+            input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of('.')) + "_" +
+            std::to_string(locality_id) + '_';
+        std::string submesh_file_postfix = input.mesh_input.mesh_file_name.substr(
+            input.mesh_input.mesh_file_name.find_last_of('.'), input.mesh_input.mesh_file_name.size());
+
+        this->locality_offset.push_back(this->submeshes.size());
+
+        uint submesh_id = 0;
+        while (Utilities::file_exists(submesh_file_prefix + std::to_string(submesh_id) + submesh_file_postfix)) {
+            this->submeshes.emplace_back();
+            this->submeshes.back().locality_id = locality_id;
+            this->submeshes.back().client.connect_to(std::string{ClientType::GetBasename()} +
+                                                     std::to_string(locality_id) + '_' + std::to_string(submesh_id));
+
+            ++submesh_id;
+        }
+    }
+}
+
+inline void WorldModel::ReportCost(uint locality_id, uint submesh_id, double compute_cost) {
+    std::lock_guard<hpx::lcos::local::mutex> lock(this->mutex);
+
+    SubmeshRecord& submesh = this->submeshes[this->locality_offset[locality_id] + submesh_id];
+
+    submesh.compute_cost = compute_cost;
+
+    if (!submesh.reported) {
+        submesh.reported = true;
+        ++this->n_reported;
+    }
+
+    if (this->n_reported == this->submeshes.size()) {
+        this->Rebalance();
+
+        for (SubmeshRecord& record : this->submeshes) {
+            record.reported = false;
+        }
+
+        this->n_reported = 0;
+    }
+}
+
+inline void WorldModel::Rebalance() {
+    const std::vector<hpx::naming::id_type> localities = hpx::find_all_localities();
+
+    std::vector<double> load(this->n_localities, 0.);
+    for (const SubmeshRecord& submesh : this->submeshes) {
+        load[submesh.locality_id] += submesh.compute_cost;
+    }
+
+    const double mean_load = std::accumulate(load.begin(), load.end(), 0.) / this->n_localities;
+
+    // Every move strictly lowers the sum of squared loads, hence the loop terminates
+    while (true) {
+        const uint max_locality = std::distance(load.begin(), std::max_element(load.begin(), load.end()));
+        const uint min_locality = std::distance(load.begin(), std::min_element(load.begin(), load.end()));
+
+        if (load[max_locality] <= (1. + WorldModel::imbalance_tolerance) * mean_load) {
+            break;
+        }
+
+        // the most expensive submesh that does not overload the target locality more than the source one
+        SubmeshRecord* move = nullptr;
+        for (SubmeshRecord& submesh : this->submeshes) {
+            if (submesh.locality_id == max_locality &&
+                submesh.compute_cost < load[max_locality] - load[min_locality] &&
+                (!move || submesh.compute_cost > move->compute_cost)) {
+                move = &submesh;
+            }
+        }
+
+        if (!move) {
+            break;
+        }
+
+        load[max_locality] -= move->compute_cost;
+        load[min_locality] += move->compute_cost;
+
+        move->client      = hpx::components::migrate(move->client, localities[min_locality]);
+        move->locality_id = min_locality;
+
+        std::cout << "Moving submesh from locality " << max_locality << " to locality " << min_locality << std::endl;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SubmeshModel Implementation
+inline SubmeshModel::SubmeshModel(const std::chrono::duration<double>& rebalance_period,
+                                  uint locality_id,
+                                  uint submesh_id)
+    : BaseType(locality_id, submesh_id), beat(rebalance_period) {}
+
+inline void SubmeshModel::InStep(uint64_t compute_cost, uint64_t) {
+    this->compute_cost += compute_cost;
+    ++this->n_steps;
+
+    if (this->beat.Thump()) {
+        assert(Greedy::world_model_client);
+        Greedy::world_model_client.ReportCost(
+            this->locality_id, this->submesh_id, (double)this->compute_cost / this->n_steps);
+
+        this->compute_cost = 0;
+        this->n_steps      = 0;
+    }
+}
+
+template <typename Archive>
+void SubmeshModel::serialize(Archive& ar, unsigned) {
+    // clang-format off
+    ar  & hpx::serialization::base_object<LoadBalancer::SubmeshModel>(*this);
+    ar  & beat
+        & compute_cost
+        & n_steps;
+    // clang-format on
+}
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+inline hpx::future<void> Greedy::initialize_locality_and_world_models(const uint locality_id,
+                                                                      const std::string& input_string) {
+    if (locality_id == 0) {
+        using WorldModelComponent                = hpx::components::simple_component<Greedy::WorldModel>;
+        hpx::future<hpx::id_type> world_model_id = hpx::new_<WorldModelComponent>(hpx::find_here(), input_string);
+
+        Greedy::world_model_client = Greedy::WorldModelClient(std::move(world_model_id));
+
+        return Greedy::world_model_client.register_as(Greedy::WorldModel::GetBasename());
+    }
+
+    Greedy::world_model_client.connect_to(Greedy::WorldModel::GetBasename());
+
+    return hpx::make_ready_future();
+}
+
+inline void Greedy::reset_locality_and_world_models() {
+    Greedy::world_model_client = WorldModelClient();
+}
+
+inline std::unique_ptr<LoadBalancer::SubmeshModel> Greedy::create_submesh_model(uint locality_id,
+                                                                                uint submesh_id,
+                                                                                double rebalance_frequency) {
+    return std::make_unique<Greedy::SubmeshModel>(
+        std::chrono::duration<double>(rebalance_frequency), locality_id, submesh_id);
+}
+}
+
+#endif
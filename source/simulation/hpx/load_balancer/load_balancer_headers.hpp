@@ -3,9 +3,12 @@
 
 #include "base_model.hpp"
 #include "random.hpp"
+#include "greedy.hpp"
 #include "abstract_load_balancer_factory.hpp"  //added for clarity
 #include "abstract_load_balancer_factory_impl.hpp"
 
-#define DGSWEMV2_REGISTER_LOAD_BALANCERS(ProblemType) DGSWEMV2_REGISTER_RANDOM_LOAD_BALANCER(ProblemType);
+#define DGSWEMV2_REGISTER_LOAD_BALANCERS()    \
+    DGSWEMV2_REGISTER_RANDOM_LOAD_BALANCER(); \
+    DGSWEMV2_REGISTER_GREEDY_LOAD_BALANCER();
 /**/
-#endif
\ No newline at end of file
+#endif
@@ -2,21 +2,23 @@
 #define LOAD_BALANCER_RANDOM_HPP
 
 #include "utilities/heartbeat.hpp"
+#include "utilities/file_exists.hpp"
+#include "preprocessor/input_parameters.hpp"
 #include "base_model.hpp"
-#include "simulation/hpx/sim_unit_hpx.hpp"
+#include "simulation/hpx/sim_unit_hpx_base.hpp"
 
 #include <cstdlib>
 
 namespace LoadBalancer {
 namespace detail_random {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename ProblemType>
-class WorldModel : public hpx::components::simple_component_base<WorldModel<ProblemType>> {
+class WorldModel : public hpx::components::simple_component_base<WorldModel> {
   public:
-    using ClientType = HPXSimulationUnitClient<ProblemType>;
+    using ClientType = HPXSimulationUnitClient;
 
     static constexpr const char* GetBasename() { return "LOAD_BALANCER_RANDOMIZED_WORLD_MODEL"; }
 
+    WorldModel() = default;
     WorldModel(const std::string& input_string);
     void MigrateOneSubmesh();
     HPX_DEFINE_COMPONENT_ACTION(WorldModel, MigrateOneSubmesh, MigrateOneSubmeshAction);
@@ -28,24 +30,21 @@ class WorldModel : public hpx::components::simple_component_base<WorldModel<Prob
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename ProblemType>
-class WorldModelClient final
-    : public hpx::components::client_base<WorldModelClient<ProblemType>, WorldModel<ProblemType>> {
+class WorldModelClient final : public hpx::components::client_base<WorldModelClient, WorldModel> {
   private:
-    using BaseType = hpx::components::client_base<WorldModelClient<ProblemType>, WorldModel<ProblemType>>;
+    using BaseType = hpx::components::client_base<WorldModelClient, WorldModel>;
 
   public:
     WorldModelClient() = default;
     WorldModelClient(hpx::future<hpx::id_type>&& id) : BaseType(std::move(id)) {}
 
     void MigrateOneSubmesh() {
-        using ActionType = typename WorldModel<ProblemType>::MigrateOneSubmeshAction;
+        using ActionType = typename WorldModel::MigrateOneSubmeshAction;
         hpx::apply<ActionType>(this->get_id());
     }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename ProblemType>
 class SubmeshModel : public LoadBalancer::SubmeshModel {
   public:
     using BaseType = LoadBalancer::SubmeshModel;
@@ -53,11 +52,11 @@ class SubmeshModel : public LoadBalancer::SubmeshModel {
     SubmeshModel() = default;
     SubmeshModel(const std::chrono::duration<double>& rebalance_period, uint locality_id, uint submesh_id);
 
-    void InStep(uint64_t compute_cost, uint64_t memory_cost);
+    void InStep(uint64_t compute_cost, uint64_t memory_cost) override;
 
     template <typename Archive>
     void serialize(Archive& ar, unsigned);
-    HPX_SERIALIZATION_POLYMORPHIC_TEMPLATE(SubmeshModel);
+    HPX_SERIALIZATION_POLYMORPHIC(SubmeshModel);
 
   private:
     Utilities::HeartBeat beat;
@@ -65,11 +64,10 @@ class SubmeshModel : public LoadBalancer::SubmeshModel {
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename ProblemType>
 struct Random {
-    using SubmeshModel     = detail_random::SubmeshModel<ProblemType>;
-    using WorldModel       = detail_random::WorldModel<ProblemType>;
-    using WorldModelClient = detail_random::WorldModelClient<ProblemType>;
+    using SubmeshModel     = detail_random::SubmeshModel;
+    using WorldModel       = detail_random::WorldModel;
+    using WorldModelClient = detail_random::WorldModelClient;
 
     static WorldModelClient world_model_client;
     static hpx::future<void> initialize_locality_and_world_models(const uint locality_id,
@@ -82,21 +80,19 @@ struct Random {
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define DGSWEMV2_REGISTER_RANDOM_LOAD_BALANCER(ProblemType)                                                \
-    using rndm_lb_world_client_ = LoadBalancer::Random<ProblemType>::WorldModelClient;                     \
-    template <>                                                                                            \
-    rndm_lb_world_client_ LoadBalancer::Random<ProblemType>::world_model_client = rndm_lb_world_client_(); \
-    using rndm_lb_world_model_           = LoadBalancer::Random<ProblemType>::WorldModel;                  \
-    using rndm_lb_world_model_component_ = hpx::components::simple_component<rndm_lb_world_model_>;        \
+// To be expanded in exactly one translation unit
+#define DGSWEMV2_REGISTER_RANDOM_LOAD_BALANCER()                                                    \
+    LoadBalancer::Random::WorldModelClient LoadBalancer::Random::world_model_client;                \
+    using rndm_lb_world_model_           = LoadBalancer::Random::WorldModel;                        \
+    using rndm_lb_world_model_component_ = hpx::components::simple_component<rndm_lb_world_model_>; \
     HPX_REGISTER_COMPONENT(rndm_lb_world_model_component_, rndm_lb_world_model_);
 /**/
 namespace LoadBalancer {
 namespace detail_random {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // WorldModel Implementation
-template <typename ProblemType>
-WorldModel<ProblemType>::WorldModel(const std::string& input_string) {
-    InputParameters<typename ProblemType::ProblemInputType> input(input_string);
+inline WorldModel::WorldModel(const std::string& input_string) {
+    InputParameters<> input(input_string);
 
     for (uint locality_id = 0; locality_id < hpx::get_initial_num_localities(); ++locality_id) {
         std::string submesh_file_prefix =
@@ -125,8 +121,7 @@ WorldModel<ProblemType>::WorldModel(const std::string& input_string) {
     std::cout << std::endl;
 }
 
-template <typename ProblemType>
-void WorldModel<ProblemType>::MigrateOneSubmesh() {
+inline void WorldModel::MigrateOneSubmesh() {
     if (!this->tried_moving_one_tile) {
         const std::vector<hpx::naming::id_type> localities = hpx::find_all_localities();
 
@@ -144,23 +139,20 @@ void WorldModel<ProblemType>::MigrateOneSubmesh() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SubmeshModel Implementation
-template <typename ProblemType>
-SubmeshModel<ProblemType>::SubmeshModel(const std::chrono::duration<double>& rebalance_period,
-                                        uint locality_id,
-                                        uint submesh_id)
+inline SubmeshModel::SubmeshModel(const std::chrono::duration<double>& rebalance_period,
+                                  uint locality_id,
+                                  uint submesh_id)
     : BaseType(locality_id, submesh_id), beat(rebalance_period) {}
 
-template <typename ProblemType>
-void SubmeshModel<ProblemType>::InStep(uint64_t, uint64_t) {
+inline void SubmeshModel::InStep(uint64_t, uint64_t) {
     if (this->locality_id == 0 && this->submesh_id == 0 && this->beat.Thump()) {
-        assert(Random<ProblemType>::world_model_client);
-        Random<ProblemType>::world_model_client.MigrateOneSubmesh();
+        assert(Random::world_model_client);
+        Random::world_model_client.MigrateOneSubmesh();
     }
 }
 
-template <typename ProblemType>
 template <typename Archive>
-void SubmeshModel<ProblemType>::serialize(Archive& ar, unsigned) {
+void SubmeshModel::serialize(Archive& ar, unsigned) {
     // clang-format off
     ar  & hpx::serialization::base_object<LoadBalancer::SubmeshModel>(*this);
     ar  & beat;
@@ -169,38 +161,39 @@ void SubmeshModel<ProblemType>::serialize(Archive& ar, unsigned) {
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename ProblemType>
-hpx::future<void> Random<ProblemType>::initialize_locality_and_world_models(const uint locality_id,
-                                                                            const std::string& input_string) {
+inline hpx::future<void> Random::initialize_locality_and_world_models(const uint locality_id,
+                                                                      const std::string& input_string) {
     if (locality_id == 0) {
         std::cout << "Initializing The world model\n";
 
-        using WorldModelComponent                = hpx::components::simple_component<Random<ProblemType>::WorldModel>;
+        using WorldModelComponent                = hpx::components::simple_component<Random::WorldModel>;
         hpx::future<hpx::id_type> world_model_id = hpx::new_<WorldModelComponent>(hpx::find_here(), input_string);
 
-        Random<ProblemType>::world_model_client = Random<ProblemType>::WorldModelClient(std::move(world_model_id));
+        Random::world_model_client = Random::WorldModelClient(std::move(world_model_id));
 
         hpx::future<void> registration_future =
-            Random<ProblemType>::world_model_client.register_as(Random<ProblemType>::WorldModel::GetBasename());
+            Random::world_model_client.register_as(Random::WorldModel::GetBasename());
 
         std::cout << "All calls made, just need to wait on future\n";
         return registration_future;
     }
+
+    // submesh 0 of locality 0 may have been migrated here
+    Random::world_model_client.connect_to(Random::WorldModel::GetBasename());
+
     return hpx::make_ready_future();
 }
 
-template <typename ProblemType>
-void Random<ProblemType>::reset_locality_and_world_models() {
-    Random<ProblemType>::world_model_client = WorldModelClient();
+inline void Random::reset_locality_and_world_models() {
+    Random::world_model_client = WorldModelClient();
 }
 
-template <typename ProblemType>
-std::unique_ptr<LoadBalancer::SubmeshModel> Random<ProblemType>::create_submesh_model(uint locality_id,
-                                                                                      uint submesh_id,
-                                                                                      double rebalance_frequency) {
-    return std::make_unique<Random<ProblemType>::SubmeshModel>(
+inline std::unique_ptr<LoadBalancer::SubmeshModel> Random::create_submesh_model(uint locality_id,
+                                                                                uint submesh_id,
+                                                                                double rebalance_frequency) {
+    return std::make_unique<Random::SubmeshModel>(
         std::chrono::duration<double>(rebalance_frequency), locality_id, submesh_id);
 }
 }
 
-#endif
\ No newline at end of file
+#endif
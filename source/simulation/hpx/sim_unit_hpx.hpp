@@ -7,20 +7,23 @@
 #include "communication/hpx_communicator.hpp"
 
 #include "simulation/hpx/sim_unit_hpx_base.hpp"
-//#include "simulation/hpx/load_balancer/base_model.hpp"
-//#include "simulation/hpx/load_balancer/abstract_load_balancer_factory.hpp"
+#include "simulation/hpx/load_balancer/load_balancer_headers.hpp"
 
 #include "problem/definitions.hpp"
 #include "problem/hpx_functions.hpp"
 
 template <typename ProblemType>
-struct HPXSimulationUnit : public HPXSimulationUnitBase,
-                           hpx::components::managed_component_base<HPXSimulationUnit<ProblemType>> {
+struct HPXSimulationUnit
+    : public hpx::components::abstract_migration_support<
+          hpx::components::component_base<HPXSimulationUnit<ProblemType>>,
+          HPXSimulationUnitBase> {
     // *** //
 
     // HPX requires these typedefs to properly disambiguate look ups
-    using wrapping_type =
-        typename hpx::components::managed_component_base<HPXSimulationUnit<ProblemType>>::wrapping_type;
+    using base_type        = hpx::components::abstract_migration_support<
+        hpx::components::component_base<HPXSimulationUnit<ProblemType>>,
+        HPXSimulationUnitBase>;
+    using wrapping_type    = typename base_type::wrapping_type;
     using type_holder      = HPXSimulationUnit<ProblemType>;
     using base_type_holder = HPXSimulationUnitBase;
 
@@ -33,7 +36,10 @@ struct HPXSimulationUnit : public HPXSimulationUnitBase,
 
     typename ProblemType::ProblemInputType problem_input;
 
-    //    std::unique_ptr<LoadBalancer::SubmeshModel> submesh_model = nullptr;
+    std::unique_ptr<LoadBalancer::SubmeshModel> submesh_model = nullptr;
+
+    // time spent in the work of the current step, excluding the waits on neighboring submeshes
+    std::chrono::steady_clock::duration compute_time = std::chrono::steady_clock::duration::zero();
 
     HPXSimulationUnit() = default;
     HPXSimulationUnit(const std::string& input_string, const uint locality_id, const uint submesh_id);
@@ -49,15 +55,14 @@ struct HPXSimulationUnit : public HPXSimulationUnitBase,
 
     double ResidualL2() override;
 
-    /*    template <typename Archive>
-        void save(Archive& ar, unsigned) const;
+    template <typename Archive>
+    void save(Archive& ar, unsigned) const;
 
-        template <typename Archive>
-        void load(Archive& ar, unsigned);
-        HPX_SERIALIZATION_SPLIT_MEMBER();
+    template <typename Archive>
+    void load(Archive& ar, unsigned);
+    HPX_SERIALIZATION_SPLIT_MEMBER();
 
-        void on_migrated();  // Do not rename this is overload member of the base class
-    */
+    void on_migrated();  // Do not rename this is overload member of the base class
 };
 
 template <typename ProblemType>
@@ -82,8 +87,8 @@ HPXSimulationUnit<ProblemType>::HPXSimulationUnit(const std::string& input_strin
 
     this->problem_input = input.problem_input;
 
-    /*    this->submesh_model = nullptr; LoadBalancer::AbstractFactory::create_submesh_model<ProblemType>(
-                                         locality_id, submesh_id, input.load_balancer_input);*/
+    this->submesh_model =
+        LoadBalancer::AbstractFactory::create_submesh_model(locality_id, submesh_id, input.load_balancer_input);
     std::cout << "Building sim unit" << '\n';
     if (this->writer.WritingLog()) {
         this->writer.StartLog();
@@ -119,18 +124,31 @@ hpx::future<void> HPXSimulationUnit<ProblemType>::Step() {
     for (uint stage = 0; stage < this->stepper.GetNumStages(); ++stage) {
         step_future = step_future.then([this](auto&& f) {
             f.get();
+
+            auto t_start = std::chrono::steady_clock::now();
+
             if (this->parser.ParsingInput()) {
                 this->parser.ParseInput(this->stepper, this->discretization.mesh);
             }
-            return ProblemType::stage_hpx(this);
+
+            // the work up to the first receive is timed, which is the bulk of the stage
+            hpx::future<void> stage_future = ProblemType::stage_hpx(this);
+
+            this->compute_time += std::chrono::steady_clock::now() - t_start;
+
+            return stage_future;
         });
     }
 
     return step_future.then([this](auto&& f) {
         f.get();
-        /*        if (this->submesh_model) {
-                    this->submesh_model->InStep(0, 0);
-                    }*/
+
+        if (this->submesh_model) {
+            this->submesh_model->InStep(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(this->compute_time).count(), 0);
+        }
+
+        this->compute_time = std::chrono::steady_clock::duration::zero();
 
         if (this->writer.WritingOutput()) {
             this->writer.WriteOutput(this->stepper, this->discretization.mesh);
@@ -149,7 +167,7 @@ double HPXSimulationUnit<ProblemType>::ResidualL2() {
 
     return residual_L2;
 }
-/*
+
 template <typename ProblemType>
 template <typename Archive>
 void HPXSimulationUnit<ProblemType>::save(Archive& ar, unsigned) const {
@@ -176,27 +194,20 @@ template <typename ProblemType>
 void HPXSimulationUnit<ProblemType>::on_migrated() {
     this->discretization.mesh.SetMasters();
 
-    this->discretization.mesh.CallForEachElement([this](auto& elt) {
-        using MasterType = typename std::remove_reference<decltype(elt)>::type::ElementMasterType;
-
-        using MasterElementTypes = typename decltype(this->discretization.mesh)::MasterElementTypes;
-
-        MasterType& master_elt =
-            std::get<Utilities::index<MasterType, MasterElementTypes>::value>(this->discretization.mesh.GetMasters());
-
-        elt.SetMaster(master_elt);
-
-        elt.Initialize();
-    });
+    this->discretization.mesh.CallForEachElement([](auto& elt) { elt.Initialize(); });
 
     initialize_mesh_interfaces_boundaries<ProblemType, HPXCommunicator>(
         discretization.mesh, problem_input, communicator, writer);
 }
-*/
 
-struct HPXEmptySimUnit : HPXSimulationUnitBase, hpx::components::managed_component_base<HPXEmptySimUnit> {
+struct HPXEmptySimUnit
+    : hpx::components::abstract_migration_support<hpx::components::component_base<HPXEmptySimUnit>,
+                                                  HPXSimulationUnitBase> {
     // HPX requires these typedefs to properly disambiguate look ups
-    using wrapping_type    = typename hpx::components::managed_component_base<HPXEmptySimUnit>::wrapping_type;
+    using base_type        = hpx::components::abstract_migration_support<
+        hpx::components::component_base<HPXEmptySimUnit>,
+        HPXSimulationUnitBase>;
+    using wrapping_type    = typename base_type::wrapping_type;
     using type_holder      = HPXEmptySimUnit;
     using base_type_holder = HPXSimulationUnitBase;
 
@@ -211,13 +222,13 @@ struct HPXEmptySimUnit : HPXSimulationUnitBase, hpx::components::managed_compone
 using RKDG_SWE_SimUnit = std::conditional<Utilities::is_defined<SWE::RKDG::Problem>::value,
                                           HPXSimulationUnit<SWE::RKDG::Problem>,
                                           HPXEmptySimUnit>::type;
-using RKDG_SWE_Server  = hpx::components::managed_component<RKDG_SWE_SimUnit>;
+using RKDG_SWE_Server  = hpx::components::component<RKDG_SWE_SimUnit>;
 HPX_REGISTER_DERIVED_COMPONENT_FACTORY(RKDG_SWE_Server, RKDG_SWE_SimUnit, "HPXSimulationUnitBase");
 
 using EHDG_SWE_SimUnit = std::conditional<Utilities::is_defined<SWE::EHDG::Problem>::value,
                                           HPXSimulationUnit<SWE::EHDG::Problem>,
                                           HPXEmptySimUnit>::type;
-using EHDG_SWE_Server  = hpx::components::managed_component<EHDG_SWE_SimUnit>;
+using EHDG_SWE_Server  = hpx::components::component<EHDG_SWE_SimUnit>;
 HPX_REGISTER_DERIVED_COMPONENT_FACTORY(EHDG_SWE_Server, EHDG_SWE_SimUnit, "HPXSimulationUnitBase");
 
 #endif
\ No newline at end of file
@@ -4,9 +4,8 @@
 #include "general_definitions.hpp"
 #include "utilities/is_defined.hpp"
 
-struct HPXSimulationUnitBase
-    //    : public hpx::components::migration_support<hpx::components::component_base<HPXSimulationUnit<ProblemType>>> {
-    : public hpx::components::abstract_managed_component_base<HPXSimulationUnitBase> {
+struct HPXSimulationUnitBase : public hpx::components::abstract_base_migration_support<
+                                   hpx::components::abstract_component_base<HPXSimulationUnitBase>> {
     ~HPXSimulationUnitBase() override = default;
 
     virtual hpx::future<void> Preprocessor() = 0;
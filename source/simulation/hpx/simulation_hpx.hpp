@@ -7,7 +7,7 @@
 #include "sim_unit_hpx_base.hpp"
 
 #include <hpx/util/unwrapped.hpp>
-//#include "simulation/hpx/load_balancer/load_balancer_headers.hpp"
+#include "simulation/hpx/load_balancer/load_balancer_headers.hpp"
 
 template <typename ClientType>
 hpx::future<double> ComputeL2Residual(std::vector<ClientType>& clients) {
@@ -34,6 +34,8 @@ class HPXSimulation : public hpx::components::component_base<HPXSimulation> {
   private:
     uint n_steps;
 
+    LoadBalancerInput load_balancer_input;
+
     std::vector<ClientType> simulation_unit_clients;
 
   public:
@@ -55,9 +57,10 @@ HPXSimulation::HPXSimulation(const std::string& input_string) {
 
     this->n_steps = (uint)std::ceil(input.stepper_input.run_time / input.stepper_input.dt);
 
-    hpx::future<void> lb_future = hpx::make_ready_future();
-    //        LoadBalancer::AbstractFactory::initialize_locality_and_world_models<ProblemType>(locality_id,
-    //        input_string);
+    this->load_balancer_input = input.load_balancer_input;
+
+    hpx::future<void> lb_future = LoadBalancer::AbstractFactory::initialize_locality_and_world_models(
+        locality_id, input_string, this->load_balancer_input);
 
     std::string submesh_file_prefix =
         input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of('.')) + "_" +
@@ -104,9 +107,9 @@ hpx::future<void> HPXSimulation::Run() {
         }
     }
 
-    return hpx::when_all(simulation_futures); /*.then([](auto&&) {
-        LoadBalancer::AbstractFactory::reset_locality_and_world_models<ProblemType>();
-        });*/
+    return hpx::when_all(simulation_futures).then([this](auto&&) {
+        LoadBalancer::AbstractFactory::reset_locality_and_world_models(this->load_balancer_input);
+    });
 }
 
 hpx::future<double> HPXSimulation::ResidualL2() {
@@ -5,12 +5,17 @@
 
 #include "preprocessor/input_parameters.hpp"
 #include "communication/ompi_communicator.hpp"
+#include "communication/ompi_reducer.hpp"
+#include "task_scheduler_ompi.hpp"
 
 #include "problem/definitions.hpp"
 #include "problem/ompi_functions.hpp"
 
 template <typename ProblemType>
 struct OMPISimulationUnit {
+    uint locality_id;
+    uint submesh_id;
+
     typename ProblemType::ProblemDiscretizationType discretization;
 
     OMPICommunicator communicator;
@@ -19,14 +24,29 @@ struct OMPISimulationUnit {
 
     typename ProblemType::ProblemInputType problem_input;
 
+    // for problems that advance sim units independently through run_tasks_ompi
+    typename ProblemType::ProblemStepperType stepper;
+    OMPITaskState task_state;
+
+    // global reductions of the rank, owned by the simulation
+    OMPIReducer* reducer = nullptr;
+
     OMPISimulationUnit() = default;
-    OMPISimulationUnit(const std::string& input_string, const uint locality_id, const uint submesh_id);
+    // migrated sim units continue the log of their previous rank
+    OMPISimulationUnit(const std::string& input_string,
+                       const uint locality_id,
+                       const uint submesh_id,
+                       const OMPISubmeshMap& submesh_map,
+                       const bool migrated = false);
 };
 
 template <typename ProblemType>
 OMPISimulationUnit<ProblemType>::OMPISimulationUnit(const std::string& input_string,
                                                     const uint locality_id,
-                                                    const uint submesh_id) {
+                                                    const uint submesh_id,
+                                                    const OMPISubmeshMap& submesh_map,
+                                                    const bool migrated)
+    : locality_id(locality_id), submesh_id(submesh_id) {
     InputParameters<typename ProblemType::ProblemInputType> input(input_string, locality_id, submesh_id);
 
     ProblemType::initialize_problem_parameters(input.problem_input);
@@ -38,13 +58,20 @@ OMPISimulationUnit<ProblemType>::OMPISimulationUnit(const std::string& input_str
     ProblemType::preprocess_mesh_data(input);
 
     this->discretization.mesh = typename ProblemType::ProblemMeshType(input.polynomial_order);
-    this->communicator        = OMPICommunicator(input.mesh_input.dbmd_data);
+    this->communicator        = OMPICommunicator(input.mesh_input.dbmd_data, submesh_map);
     this->writer              = typename ProblemType::ProblemWriterType(input.writer_input, locality_id, submesh_id);
     this->parser              = typename ProblemType::ProblemParserType(input, locality_id, submesh_id);
 
     this->problem_input = input.problem_input;
 
-    if (this->writer.WritingLog()) {
+    if (this->writer.WritingLog() && migrated) {
+        this->writer.ResumeLog();
+
+        int rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+        this->writer.GetLogFile() << "Arriving on rank " << rank << std::endl;
+    } else if (this->writer.WritingLog()) {
         this->writer.StartLog();
 
         this->writer.GetLogFile() << "Starting simulation with p=" << input.polynomial_order << " for "
@@ -54,6 +81,12 @@ OMPISimulationUnit<ProblemType>::OMPISimulationUnit(const std::string& input_str
 
     this->discretization.initialize(input, this->communicator, this->writer);
 
+#ifdef SINGLE_PRECISION_MESSAGES
+    for (uint comm_type : ProblemType::single_precision_comms()) {
+        this->communicator.SetSinglePrecision(comm_type);
+    }
+#endif
+
     this->communicator.InitializeCommunication();
 }
 
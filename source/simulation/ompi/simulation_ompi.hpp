@@ -3,6 +3,9 @@
 
 #include <omp.h>
 
+#include <chrono>
+#include <numeric>
+
 #include "general_definitions.hpp"
 #include "preprocessor/input_parameters.hpp"
 #include "utilities/file_exists.hpp"
@@ -13,11 +16,24 @@ class OMPISimulation : public OMPISimulationBase {
   private:
     uint n_steps;
 
+    std::string input_string;
+
     std::vector<std::unique_ptr<OMPISimulationUnit<ProblemType>>> sim_units;
     typename ProblemType::ProblemGlobalDataType global_data;
 
     typename ProblemType::ProblemStepperType stepper;
 
+    OMPIReducer reducer;
+    std::vector<double> first_result;
+
+    OMPISubmeshMap submesh_map;
+
+    uint repartition_frequency = 0;  // in steps, 0 if submeshes stay on their ranks
+    bool repartitioned         = false;
+    std::vector<std::vector<double>> sim_unit_states;
+
+    static constexpr double imbalance_tolerance = 0.1;
+
   public:
     OMPISimulation() = default;
     OMPISimulation(const std::string& input_string);
@@ -25,12 +41,21 @@ class OMPISimulation : public OMPISimulationBase {
     void Run() override;
     void ComputeL2Residual() override;
     void Finalize() override;
+
+  private:
+    void Repartition(std::true_type, uint& begin_sim_id, uint& end_sim_id);
+    void Repartition(std::false_type, uint&, uint&) {}
+
+    void MoveSubmeshes();
+
+    void MonitorReductions(const bool last_round);
 };
 
 template <typename ProblemType>
-OMPISimulation<ProblemType>::OMPISimulation(const std::string& input_string) {
-    int locality_id;
+OMPISimulation<ProblemType>::OMPISimulation(const std::string& input_string) : input_string(input_string) {
+    int locality_id, n_localities;
     MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_localities);
 
     InputParameters<typename ProblemType::ProblemInputType> input(input_string);
 
@@ -38,20 +63,55 @@ OMPISimulation<ProblemType>::OMPISimulation(const std::string& input_string) {
 
     this->stepper = typename ProblemType::ProblemStepperType(input.stepper_input);
 
+    if (input.load_balancer_input.use_load_balancer) {
+        if (input.load_balancer_input.name != "greedy" || !ProblemType::ompi_repartitioning) {
+            throw std::logic_error("Fatal Error: load balancer " + input.load_balancer_input.name +
+                                   " is not supported for this problem by the OpenMP+MPI driver!\n");
+        }
+
+        // ranks have to agree on when to repartition, hence the frequency is taken in simulated time
+        this->repartition_frequency =
+            std::max(1u, (uint)std::round(input.load_balancer_input.rebalance_frequency / input.stepper_input.dt));
+    }
+
     std::string submesh_file_prefix =
         input.mesh_input.mesh_file_name.substr(0, input.mesh_input.mesh_file_name.find_last_of('.')) + "_" +
         std::to_string(locality_id) + '_';
     std::string submesh_file_postfix = input.mesh_input.mesh_file_name.substr(
         input.mesh_input.mesh_file_name.find_last_of('.'), input.mesh_input.mesh_file_name.size());
 
-    uint submesh_id = 0;
+    uint n_submeshes = 0;
+    while (Utilities::file_exists(submesh_file_prefix + std::to_string(n_submeshes) + submesh_file_postfix)) {
+        ++n_submeshes;
+    }
+
+    std::vector<uint>& offset = this->submesh_map.offset;
+
+    offset.resize(n_localities + 1, 0);
+    MPI_Allgather(&n_submeshes, 1, MPI_UNSIGNED, &offset[1], 1, MPI_UNSIGNED, MPI_COMM_WORLD);
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    for (int locality = 0; locality < n_localities; ++locality) {
+        this->submesh_map.rank.resize(offset[locality + 1], locality);
+    }
 
-    while (Utilities::file_exists(submesh_file_prefix + std::to_string(submesh_id) + submesh_file_postfix)) {
-        this->sim_units.emplace_back(new OMPISimulationUnit<ProblemType>(input_string, locality_id, submesh_id));
+    for (uint submesh_id = 0; submesh_id < n_submeshes; ++submesh_id) {
+        this->sim_units.emplace_back(
+            new OMPISimulationUnit<ProblemType>(input_string, locality_id, submesh_id, this->submesh_map));
 
-        ++submesh_id;
+        this->sim_units.back()->reducer = &this->reducer;
     }
 
+    ProblemType::initialize_reductions_ompi(this->reducer);
+    this->reducer.SetContributors(this->sim_units.size());
+
+    std::vector<OMPICommunicator*> communicators;
+    for (auto& sim_unit : this->sim_units) {
+        communicators.push_back(&sim_unit->communicator);
+    }
+
+    OMPICommunicator::ConnectSharedBoundaries(communicators);
+
     if (this->sim_units.empty()) {
         std::cerr << "Warning: MPI Rank " << locality_id << " has not been assigned any work. This may inidicate\n"
                   << "         poor partitioning and imply degraded performance." << std::endl;
@@ -89,10 +149,248 @@ void OMPISimulation<ProblemType>::Run() {
 
         for (uint step = 1; step <= this->n_steps; ++step) {
             ProblemType::step_ompi(this->sim_units, this->global_data, this->stepper, begin_sim_id, end_sim_id);
+
+#pragma omp master
+            this->MonitorReductions(false);
+
+            if (this->repartition_frequency && step % this->repartition_frequency == 0 && step < this->n_steps) {
+                this->Repartition(
+                    std::integral_constant<bool, ProblemType::ompi_repartitioning>(), begin_sim_id, end_sim_id);
+            }
+        }
+
+#pragma omp master
+        {
+            this->reducer.Complete();
+
+            this->MonitorReductions(true);
         }
     }  // close omp parallel region
 }
 
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::MonitorReductions(const bool last_round) {
+    // ranks without sim units take part in every round nonetheless
+    if (this->sim_units.empty() && !last_round) {
+        this->reducer.Arrive();
+    }
+
+    // other threads may have started further rounds already, results are monitored in order
+    std::vector<double> result;
+    bool has_result = this->reducer.GetResult(result);
+
+    while (has_result) {
+        if (this->first_result.empty()) {
+            this->first_result = result;
+        }
+
+        std::vector<double> next_result;
+        has_result = this->reducer.GetResult(next_result);
+
+        ProblemType::monitor_reductions_ompi(this->first_result, result, last_round && !has_result);
+
+        result = std::move(next_result);
+    }
+}
+
+// To be called by all threads of the parallel region in between steps
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::Repartition(std::true_type, uint& begin_sim_id, uint& end_sim_id) {
+#pragma omp barrier
+#pragma omp single
+    this->MoveSubmeshes();
+
+    if (!this->repartitioned) {
+        return;
+    }
+
+    const uint n_threads      = (uint)omp_get_num_threads();
+    const uint thread_id      = (uint)omp_get_thread_num();
+    const uint sim_per_thread = (this->sim_units.size() + n_threads - 1) / n_threads;
+
+    begin_sim_id = sim_per_thread * thread_id;
+    end_sim_id   = std::min(sim_per_thread * (thread_id + 1), (uint)this->sim_units.size());
+
+    // the preprocessor resets elements to the initial conditions, states are restored afterwards
+    ProblemType::preprocessor_ompi(this->sim_units, this->global_data, this->stepper, begin_sim_id, end_sim_id);
+
+    for (uint su_id = begin_sim_id; su_id < end_sim_id; ++su_id) {
+        ProblemType::unpack_state(this->sim_units[su_id]->discretization.mesh, this->sim_unit_states[su_id]);
+    }
+
+#pragma omp barrier
+}
+
+// Moves whole submeshes from the ranks with the largest cost per step to the ones with the smallest, as the greedy
+// HPX load balancer does. Moved submeshes are rebuilt from their input files on the receiving rank, only the
+// state of their elements is sent along. To be called by a single thread once all ranks completed the same step.
+template <typename ProblemType>
+void OMPISimulation<ProblemType>::MoveSubmeshes() {
+    int locality_id, n_localities;
+    MPI_Comm_rank(MPI_COMM_WORLD, &locality_id);
+    MPI_Comm_size(MPI_COMM_WORLD, &n_localities);
+
+    const uint n_submeshes = this->submesh_map.rank.size();
+
+    std::vector<double> compute_cost(n_submeshes, 0.);
+    std::vector<uint> n_wet(n_submeshes, 0);
+
+    for (auto& sim_unit : this->sim_units) {
+        const uint submesh_id = this->submesh_map.GetGlobalId(sim_unit->locality_id, sim_unit->submesh_id);
+
+        compute_cost[submesh_id] = std::chrono::duration<double>(sim_unit->task_state.compute_time).count() /
+                                   this->repartition_frequency;
+        n_wet[submesh_id] = ProblemType::count_wet_elements(sim_unit->discretization.mesh);
+
+        sim_unit->task_state.compute_time = std::chrono::steady_clock::duration::zero();
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, compute_cost.data(), n_submeshes, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, n_wet.data(), n_submeshes, MPI_UNSIGNED, MPI_SUM, MPI_COMM_WORLD);
+
+    // all ranks arrive at the same plan
+    OMPISubmeshMap new_submesh_map = this->submesh_map;
+
+    std::vector<double> load(n_localities, 0.);
+    for (uint submesh_id = 0; submesh_id < n_submeshes; ++submesh_id) {
+        load[this->submesh_map.rank[submesh_id]] += compute_cost[submesh_id];
+    }
+
+    const double mean_load = std::accumulate(load.begin(), load.end(), 0.) / n_localities;
+
+    while (true) {
+        const int max_rank = std::distance(load.begin(), std::max_element(load.begin(), load.end()));
+        const int min_rank = std::distance(load.begin(), std::min_element(load.begin(), load.end()));
+
+        if (load[max_rank] <= (1. + OMPISimulation::imbalance_tolerance) * mean_load) {
+            break;
+        }
+
+        int move = -1;
+        for (uint submesh_id = 0; submesh_id < n_submeshes; ++submesh_id) {
+            if (new_submesh_map.rank[submesh_id] == max_rank &&
+                compute_cost[submesh_id] < load[max_rank] - load[min_rank] &&
+                (move < 0 || compute_cost[submesh_id] > compute_cost[move])) {
+                move = submesh_id;
+            }
+        }
+
+        if (move < 0) {
+            break;
+        }
+
+        load[max_rank] -= compute_cost[move];
+        load[min_rank] += compute_cost[move];
+
+        new_submesh_map.rank[move] = min_rank;
+
+        if (locality_id == 0) {
+            const uint locality = this->submesh_map.GetLocalityId(move);
+
+            std::cout << "Moving submesh " << locality << '_' << move - this->submesh_map.offset[locality]
+                      << " (wet elements: " << n_wet[move]
+                      << ", time per step: " << compute_cost[move] << " s) from rank " << max_rank << " to rank "
+                      << min_rank << std::endl;
+        }
+    }
+
+    this->repartitioned = (new_submesh_map.rank != this->submesh_map.rank);
+
+    if (!this->repartitioned) {
+        return;
+    }
+
+    std::vector<std::unique_ptr<OMPISimulationUnit<ProblemType>>> sim_units;
+    std::vector<std::vector<double>> sim_unit_states;
+
+    std::vector<std::vector<double>> send_states;
+    std::vector<MPI_Request> send_requests;
+
+    send_states.reserve(this->sim_units.size());
+
+    for (auto& sim_unit : this->sim_units) {
+        const uint submesh_id = this->submesh_map.GetGlobalId(sim_unit->locality_id, sim_unit->submesh_id);
+
+        std::vector<double> state;
+        ProblemType::pack_state(sim_unit->discretization.mesh, state);
+
+        if (new_submesh_map.rank[submesh_id] == locality_id) {
+            sim_units.push_back(std::move(sim_unit));
+            sim_unit_states.push_back(std::move(state));
+        } else {
+            if (sim_unit->writer.WritingLog()) {
+                sim_unit->writer.GetLogFile() << "Departing from rank " << locality_id << std::endl;
+            }
+
+            send_states.push_back(std::move(state));
+            send_requests.emplace_back();
+
+            MPI_Isend(send_states.back().data(),
+                      send_states.back().size(),
+                      MPI_DOUBLE,
+                      new_submesh_map.rank[submesh_id],
+                      submesh_id,
+                      MPI_COMM_WORLD,
+                      &send_requests.back());
+        }
+    }
+
+    for (auto& sim_unit : sim_units) {
+        sim_unit->communicator.Remap(new_submesh_map);
+    }
+
+    for (uint submesh_id = 0; submesh_id < n_submeshes; ++submesh_id) {
+        if (new_submesh_map.rank[submesh_id] != locality_id || this->submesh_map.rank[submesh_id] == locality_id) {
+            continue;
+        }
+
+        const uint locality = new_submesh_map.GetLocalityId(submesh_id);
+
+        sim_units.emplace_back(new OMPISimulationUnit<ProblemType>(this->input_string,
+                                                                  locality,
+                                                                  submesh_id - new_submesh_map.offset[locality],
+                                                                  new_submesh_map,
+                                                                  true));
+
+        sim_units.back()->reducer = &this->reducer;
+
+        if (sim_units.back()->writer.WritingOutput()) {
+            sim_units.back()->writer.InitializeOutput(sim_units.back()->discretization.mesh);
+        }
+
+        MPI_Status status;
+        int count;
+
+        MPI_Probe(this->submesh_map.rank[submesh_id], submesh_id, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_DOUBLE, &count);
+
+        sim_unit_states.emplace_back(count);
+
+        MPI_Recv(sim_unit_states.back().data(),
+                 count,
+                 MPI_DOUBLE,
+                 this->submesh_map.rank[submesh_id],
+                 submesh_id,
+                 MPI_COMM_WORLD,
+                 MPI_STATUS_IGNORE);
+    }
+
+    MPI_Waitall(send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
+
+    this->sim_units       = std::move(sim_units);
+    this->sim_unit_states = std::move(sim_unit_states);
+    this->submesh_map     = std::move(new_submesh_map);
+
+    this->reducer.SetContributors(this->sim_units.size());
+
+    std::vector<OMPICommunicator*> communicators;
+    for (auto& sim_unit : this->sim_units) {
+        communicators.push_back(&sim_unit->communicator);
+    }
+
+    OMPICommunicator::ConnectSharedBoundaries(communicators);
+}
+
 template <typename ProblemType>
 void OMPISimulation<ProblemType>::ComputeL2Residual() {
     int locality_id;
@@ -0,0 +1,87 @@
+#ifndef TASK_SCHEDULER_OMPI_HPP
+#define TASK_SCHEDULER_OMPI_HPP
+
+#include <omp.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "general_definitions.hpp"
+
+// Progress of a sim unit through its task sequence, owned by the sim unit
+struct OMPITaskState {
+    std::atomic_flag busy = ATOMIC_FLAG_INIT;
+    std::atomic<uint> n_tasks_done{0};
+
+    // time spent in tasks, used to balance load across ranks
+    std::chrono::steady_clock::duration compute_time{0};
+};
+
+// Work-stealing execution of per sim unit task sequences, to be called by every thread of a parallel region.
+// Tasks of a sim unit run in order, each one on whichever thread finds it ready(sim_unit, task), e.g. once
+// the messages it depends on have arrived. Threads start on their own block of sim units and move on to any
+// other sim unit while theirs wait, hence no thread idles as long as some sim unit can make progress.
+// Returns after all sim units completed n_tasks tasks.
+template <typename SimUnitType, typename ReadyType, typename TaskType>
+void run_tasks_ompi(std::vector<std::unique_ptr<SimUnitType>>& sim_units,
+                    const uint n_tasks,
+                    const ReadyType& ready,
+                    const TaskType& run_task) {
+    const uint n_sim_units = sim_units.size();
+    const uint first_sim_id =
+        n_sim_units ? n_sim_units * (uint)omp_get_thread_num() / (uint)omp_get_num_threads() : 0;
+
+    bool done = false;
+
+    while (!done) {
+        bool progress = false;
+
+        done = true;
+
+        for (uint offset = 0; offset < n_sim_units; ++offset) {
+            SimUnitType& sim_unit     = *sim_units[(first_sim_id + offset) % n_sim_units];
+            OMPITaskState& task_state = sim_unit.task_state;
+
+            if (task_state.n_tasks_done.load(std::memory_order_acquire) == n_tasks) {
+                continue;
+            }
+
+            done = false;
+
+            if (task_state.busy.test_and_set(std::memory_order_acquire)) {
+                continue;
+            }
+
+            uint task = task_state.n_tasks_done.load(std::memory_order_relaxed);
+
+            while (task < n_tasks && ready(sim_unit, task)) {
+                auto t_start = std::chrono::steady_clock::now();
+
+                run_task(sim_unit, task);
+
+                task_state.compute_time += std::chrono::steady_clock::now() - t_start;
+
+                task_state.n_tasks_done.store(++task, std::memory_order_release);
+
+                progress = true;
+            }
+
+            task_state.busy.clear(std::memory_order_release);
+        }
+
+        if (!done && !progress) {
+            std::this_thread::yield();
+        }
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+        for (auto& sim_unit : sim_units) {
+            sim_unit->task_state.n_tasks_done.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif
@@ -6,15 +6,23 @@
 #include "preprocessor/input_parameters.hpp"
 
 /**
- * Explicit Strong Stability preserving Runge-Kutta methods
- * Class discretizes an ODE using strong stability preserving Runge Kutta methods.
+ * Implicit time stepping methods
+ * Stage i solves (q_i - q_base) / dt = a_ii * L(q_i) + sum_j a_ij * L(q_j), where q_j for j < i are the states
+ * at previous stages and q_0 is the state at the current time level. Supported are theta methods (backward Euler
+ * and Crank-Nicolson), L-stable singly diagonally implicit Runge-Kutta methods, and BDF2, for which
+ * q_base = 4/3 * q_n - 1/3 * q_nm1.
  */
 class ImplicitStepper {
   private:
     uint order;
     uint nstages;
     double dt;
-    double theta;
+
+    std::vector<double> implicit_weight;
+    std::vector<std::vector<double>> explicit_weight;
+    std::vector<double> c;
+
+    bool bdf2;
 
     uint step;
     uint stage;
@@ -31,32 +39,98 @@ class ImplicitStepper {
         : order(stepper_input.order),
           nstages(stepper_input.nstages),
           dt(stepper_input.dt),
+          bdf2(false),
           step(0),
           stage(0),
           timestamp(0),
           t(0.),
           ramp_duration(stepper_input.ramp_duration),
-          ramp(Utilities::almost_equal(ramp_duration, 0) ? 1. : 0.),
-          ramp_next(Utilities::almost_equal(ramp_duration, 0)
-                        ? 1.
-                        : std::tanh(2 * (this->dt / 86400) / this->ramp_duration)) {
-        if (this->order == 1 && this->nstages == 1) {
-            this->theta = 0.0;
-        } else if (this->order == 2 && this->nstages == 1) {
-            this->theta = 0.5;
-        } else if (this->order == 2 && this->nstages == 2) {
-            this->nstages = 1;
-            this->theta   = 0.5;
+          ramp(Utilities::almost_equal(ramp_duration, 0) ? 1. : 0.) {
+        if (stepper_input.method.empty() || stepper_input.method == "theta") {
+            double theta;
+
+            if (this->order == 1 && this->nstages == 1) {
+                theta = 0.0;
+            } else if (this->order == 2 && this->nstages == 1) {
+                theta = 0.5;
+            } else if (this->order == 2 && this->nstages == 2) {
+                this->nstages = 1;
+                theta         = 0.5;
+            } else {
+                std::cout << this->order << ' ' << this->nstages << '\n';
+                throw std::logic_error("Fatal Error: invalid implicit method entered!");
+            }
+
+            this->implicit_weight = {1.0 - theta};
+            this->explicit_weight = {{theta}};
+            this->c               = {1.0};
+        } else if (stepper_input.method == "SDIRK") {
+            if (this->order == 2 && this->nstages == 2) {
+                // L-stable, stiffly accurate SDIRK2
+                const double gamma = 1.0 - 1.0 / std::sqrt(2.0);
+
+                this->implicit_weight = {gamma, gamma};
+                this->explicit_weight = {{0.0}, {0.0, 1.0 - gamma}};
+                this->c               = {gamma, 1.0};
+            } else if (this->order == 3 && this->nstages == 3) {
+                // L-stable, stiffly accurate SDIRK3 (Alexander, 1977)
+                const double gamma = 0.435866521508459;
+                const double tau   = (1.0 + gamma) / 2.0;
+                const double b1    = -(6.0 * gamma * gamma - 16.0 * gamma + 1.0) / 4.0;
+                const double b2    = (6.0 * gamma * gamma - 20.0 * gamma + 5.0) / 4.0;
+
+                this->implicit_weight = {gamma, gamma, gamma};
+                this->explicit_weight = {{0.0}, {0.0, tau - gamma}, {0.0, b1, b2}};
+                this->c               = {gamma, tau, 1.0};
+            } else {
+                std::cout << this->order << ' ' << this->nstages << '\n';
+                throw std::logic_error("Fatal Error: invalid SDIRK method entered!");
+            }
+        } else if (stepper_input.method == "BDF2") {
+            if (this->order != 2 || this->nstages != 1) {
+                std::cout << this->order << ' ' << this->nstages << '\n';
+                throw std::logic_error("Fatal Error: invalid BDF2 method entered!");
+            }
+
+            // the first step, where no previous time level is available, is taken with backward Euler
+            this->bdf2            = true;
+            this->implicit_weight = {2.0 / 3.0};
+            this->explicit_weight = {{0.0}};
+            this->c               = {1.0};
         } else {
-            std::cout << this->order << ' ' << this->nstages << '\n';
-            throw std::logic_error("Fatal Error: invalid implicit method entered!");
+            throw std::logic_error("Fatal Error: unknown implicit method " + stepper_input.method + '\n');
         }
+
+        this->ramp_next = Utilities::almost_equal(this->ramp_duration, 0)
+                              ? 1.
+                              : std::tanh(2 * (this->GetTimeAtNextStage() / 86400) / this->ramp_duration);
     }
 
     uint GetOrder() const { return this->order; }
     uint GetNumStages() const { return this->nstages; }
     double GetDT() const { return this->dt; }
-    double GetTheta() const { return this->theta; }
+
+    // weight of the residual at the state being solved for
+    double GetImplicitWeight() const {
+        return (this->bdf2 && this->step == 0) ? 1.0 : this->implicit_weight[this->stage];
+    }
+
+    // weight of the residual at the state of stage stage_j <= current stage
+    double GetExplicitWeight(const uint stage_j) const { return this->explicit_weight[this->stage][stage_j]; }
+
+    // residual at the state of the current stage is required by the current or a later stage
+    bool StageRHSRequired() const {
+        for (uint stage_i = this->stage; stage_i < this->nstages; ++stage_i) {
+            if (this->explicit_weight[stage_i][this->stage] != 0.0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // q_base = (1 + history_weight) * q_n - history_weight * q_nm1
+    double GetHistoryWeight() const { return (this->bdf2 && this->step != 0) ? 1.0 / 3.0 : 0.0; }
 
     void SetDT(double dt) { this->dt = dt; };
 
@@ -64,8 +138,10 @@ class ImplicitStepper {
     uint GetStage() const { return this->stage; }
     uint GetTimestamp() const { return this->timestamp; }
 
-    double GetTimeAtCurrentStage() const { return this->t; }
-    double GetTimeAtNextStage() const { return this->t + this->dt; }
+    double GetTimeAtCurrentStage() const {
+        return this->t + (this->stage == 0 ? 0.0 : this->c[this->stage - 1] * this->dt);
+    }
+    double GetTimeAtNextStage() const { return this->t + this->c[this->stage] * this->dt; }
     double GetRamp() const { return this->ramp; }
     double GetRampNext() const { return this->ramp_next; }
 
@@ -89,4 +165,4 @@ class ImplicitStepper {
     }
 };
 
-#endif
\ No newline at end of file
+#endif
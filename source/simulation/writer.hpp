@@ -45,10 +45,12 @@ class Writer {
     bool WritingVerboseLog() const { return (this->writing_log_file && this->verbose_log_file); }
     std::ofstream& GetLogFile() const { return this->log_file; }
     void StartLog();
+    void ResumeLog();
 
     bool WritingOutput() { return this->writing_output; }
     void WriteFirstStep(const typename ProblemType::ProblemStepperType& stepper,
                         typename ProblemType::ProblemMeshType& mesh);
+    void InitializeOutput(typename ProblemType::ProblemMeshType& mesh);
     void WriteOutput(const typename ProblemType::ProblemStepperType& stepper,
                      typename ProblemType::ProblemMeshType& mesh);
 
@@ -117,9 +119,25 @@ void Writer<ProblemType>::StartLog() {
     }
 }
 
+template <typename ProblemType>
+void Writer<ProblemType>::ResumeLog() {
+    this->log_file = std::ofstream(this->log_file_name + '_' + std::to_string(version++), std::ios_base::app);
+
+    if (!this->log_file) {
+        std::cerr << "Error in opening log file, presumably the output directory does not exists.\n";
+    }
+}
+
 template <typename ProblemType>
 void Writer<ProblemType>::WriteFirstStep(const typename ProblemType::ProblemStepperType& stepper,
                                          typename ProblemType::ProblemMeshType& mesh) {
+    this->InitializeOutput(mesh);
+
+    this->WriteOutput(stepper, mesh);
+}
+
+template <typename ProblemType>
+void Writer<ProblemType>::InitializeOutput(typename ProblemType::ProblemMeshType& mesh) {
     if (this->writing_vtk_output) {
         this->vtk_file_name_geom = this->output_path + mesh.GetMeshName() + "_geometry.vtk";
         this->vtk_file_name_raw  = this->output_path + mesh.GetMeshName() + "_raw_data.vtk";
@@ -134,8 +152,6 @@ void Writer<ProblemType>::WriteFirstStep(const typename ProblemType::ProblemStep
 
         this->InitializeMeshGeometryVTU(mesh);
     }
-
-    this->WriteOutput(stepper, mesh);
 }
 
 template <typename ProblemType>
@@ -238,6 +254,9 @@ void Writer<ProblemType>::InitializeMeshGeometryVTK(typename ProblemType::Proble
             case VTKElementTypes::straight_triangle:
                 n_cell_entries += 4;
                 break;
+            case VTKElementTypes::straight_quadrilateral:
+                n_cell_entries += 5;
+                break;
             default:
                 printf("\n");
                 printf("MESH InitializeVTK - Fatal error!\n");
@@ -256,6 +275,10 @@ void Writer<ProblemType>::InitializeMeshGeometryVTK(typename ProblemType::Proble
                 file << 3 << '\t';
                 n_nodes = 3;
                 break;
+            case VTKElementTypes::straight_quadrilateral:
+                file << 4 << '\t';
+                n_nodes = 4;
+                break;
             default:
                 printf("\n");
                 printf("MESH InitializeVTK - Fatal error!\n");
@@ -317,6 +340,9 @@ void Writer<ProblemType>::InitializeMeshGeometryVTU(typename ProblemType::Proble
             case VTKElementTypes::straight_triangle:
                 n_nodes = 3;
                 break;
+            case VTKElementTypes::straight_quadrilateral:
+                n_nodes = 4;
+                break;
             default:
                 printf("\n");
                 printf("MESH InitializeVTK - Fatal error!\n");
@@ -341,6 +367,10 @@ void Writer<ProblemType>::InitializeMeshGeometryVTU(typename ProblemType::Proble
                 offset += 3;
                 file << offset << ' ';
                 break;
+            case VTKElementTypes::straight_quadrilateral:
+                offset += 4;
+                file << offset << ' ';
+                break;
             default:
                 printf("\n");
                 printf("MESH InitializeVTK - Fatal error!\n");
@@ -0,0 +1,122 @@
+#ifndef GMRES_HPP
+#define GMRES_HPP
+
+#include "utilities/linear_algebra.hpp"
+
+// Restarted right preconditioned GMRES(m) with Givens rotations.
+// Operator A and preconditioner M_inv are only accessed through their action,
+// i.e. A(x, Ax) and M_inv(x, M_inv_x), which allows for matrix-free global problems.
+// Returns the number of iterations, convergence is achieved when ||b - Ax|| <= tolerance * ||b||.
+template <typename T, typename OperatorType, typename PreconditionerType>
+uint solve_gmres(const OperatorType& A,
+                 const PreconditionerType& M_inv,
+                 const DynVector<T>& b,
+                 DynVector<T>& x,
+                 const double tolerance,
+                 const uint max_iterations,
+                 const uint restart) {
+    const double b_norm = norm(b);
+
+    if (b_norm == 0.0) {
+        set_constant(x, 0.0);
+
+        return 0;
+    }
+
+    DynVector<T> r(b);
+    DynVector<T> w(b);
+    DynVector<T> z(b);
+
+    std::vector<DynVector<T>> V(restart + 1, b);
+    std::vector<std::vector<double>> H(restart + 1, std::vector<double>(restart, 0.0));
+
+    std::vector<double> cs(restart);
+    std::vector<double> sn(restart);
+    std::vector<double> g(restart + 1);
+    std::vector<double> y(restart);
+
+    A(x, w);
+    r = b - w;
+
+    double r_norm = norm(r);
+
+    uint iter = 0;
+
+    while (r_norm > tolerance * b_norm && iter < max_iterations) {
+        V[0] = r / r_norm;
+
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = r_norm;
+
+        uint k = 0;
+        while (k < restart && iter < max_iterations) {
+            M_inv(V[k], z);
+            A(z, w);
+
+            // modified Gram-Schmidt
+            for (uint i = 0; i <= k; ++i) {
+                H[i][k] = dot(w, V[i]);
+                w -= H[i][k] * V[i];
+            }
+
+            H[k + 1][k] = norm(w);
+
+            if (H[k + 1][k] != 0.0) {
+                V[k + 1] = w / H[k + 1][k];
+            }
+
+            for (uint i = 0; i < k; ++i) {
+                const double H_ik = H[i][k];
+
+                H[i][k]     = cs[i] * H_ik + sn[i] * H[i + 1][k];
+                H[i + 1][k] = -sn[i] * H_ik + cs[i] * H[i + 1][k];
+            }
+
+            const double denom = std::hypot(H[k][k], H[k + 1][k]);
+
+            cs[k] = H[k][k] / denom;
+            sn[k] = H[k + 1][k] / denom;
+
+            H[k][k]     = denom;
+            H[k + 1][k] = 0.0;
+
+            g[k + 1] = -sn[k] * g[k];
+            g[k]     = cs[k] * g[k];
+
+            ++k;
+            ++iter;
+
+            if (std::abs(g[k]) <= tolerance * b_norm) {
+                break;
+            }
+        }
+
+        // solve the upper triangular least squares problem
+        for (int i = k - 1; i >= 0; --i) {
+            y[i] = g[i];
+
+            for (uint j = i + 1; j < k; ++j) {
+                y[i] -= H[i][j] * y[j];
+            }
+
+            y[i] /= H[i][i];
+        }
+
+        set_constant(w, 0.0);
+        for (uint i = 0; i < k; ++i) {
+            w += y[i] * V[i];
+        }
+
+        M_inv(w, z);
+        x += z;
+
+        A(x, w);
+        r = b - w;
+
+        r_norm = norm(r);
+    }
+
+    return iter;
+}
+
+#endif
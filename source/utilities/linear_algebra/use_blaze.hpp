@@ -36,6 +36,10 @@ template <typename T, bool SO = blaze::rowMajor>
 using DynMatrix = blaze::DynamicMatrix<T, SO>;
 template <typename T, uint m>
 using HybMatrix = blaze::HybridMatrix<T, m, hyb_mat_buff_size>;
+template <typename T>
+using DynMatrixMap = blaze::CustomMatrix<T, blaze::unaligned, blaze::unpadded>;
+template <typename T>
+using DiagMatrix = blaze::DiagonalMatrix<blaze::DynamicMatrix<T>>;
 
 template <typename T>
 using SparseVector = blaze::CompressedVector<T>;
@@ -111,7 +115,18 @@ decltype(auto) power(const ArrayType& array, const double exp) {
     return blaze::pow(array, exp);
 }
 
+// Blaze evaluates into the lefthand side unless it detects aliasing, noalias is kept for parity with Eigen
+template <typename ArrayType>
+decltype(auto) noalias(ArrayType&& array) {
+    return std::forward<ArrayType>(array);
+}
+
 /* Vector Operations */
+template <typename LeftVectorType, typename RightVectorType>
+double dot(const LeftVectorType& vector_left, const RightVectorType& vector_right) {
+    return blaze::dot(vector_left, vector_right);
+}
+
 template <typename LeftVectorType, typename RightVectorType>
 decltype(auto) vec_cw_mult(const LeftVectorType& vector_left, const RightVectorType& vector_right) {
     return vector_left * vector_right;
@@ -148,6 +163,11 @@ blaze::DynamicMatrix<T, SO> reshape(const DynVector<T>& vector, const int m, con
 }
 
 /* Matrix Operations */
+template <typename T>
+DynMatrixMap<T> matrix_from_array(T* array, const uint m, const uint n) {
+    return DynMatrixMap<T>(array, m, n);
+}
+
 template <typename MatrixType>
 uint rows(const MatrixType& matrix) {
     return blaze::rows(matrix);
@@ -177,6 +197,16 @@ decltype(auto) column(MatrixType&& matrix, const uint col) {
     return blaze::column(std::forward<MatrixType>(matrix), col);
 }
 
+template <typename T, typename MatrixType>
+DiagMatrix<T> diagonal_matrix(const MatrixType& matrix) {
+    return DiagMatrix<T>(matrix);
+}
+
+template <typename MatrixType>
+const MatrixType& by_reference(const MatrixType& matrix) {
+    return matrix;
+}
+
 template <typename MatrixType>
 double determinant(MatrixType& matrix) {
     return blaze::det(matrix);
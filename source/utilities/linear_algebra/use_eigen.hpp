@@ -32,6 +32,10 @@ template <typename T, int SO = SO::ColumnMajor>
 using DynMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
 template <typename T, uint m>
 using HybMatrix = Eigen::Matrix<T, m, Eigen::Dynamic>;
+template <typename T>
+using DynMatrixMap = Eigen::Map<DynMatrix<T>>;
+template <typename T>
+using DiagMatrix = Eigen::DiagonalMatrix<T, Eigen::Dynamic>;
 
 template <typename T>
 using SparseVector = Eigen::SparseVector<T>;
@@ -93,7 +97,19 @@ decltype(auto) power(const ArrayType& array, const double exp) {
     return array.array().pow(exp);
 }
 
+// Assignments through noalias(array) evaluate products directly into array instead of a heap temporary,
+// hence array must not appear on the righthand side
+template <typename ArrayType>
+decltype(auto) noalias(ArrayType&& array) {
+    return array.noalias();
+}
+
 /* Vector Operations */
+template <typename LeftVectorType, typename RightVectorType>
+double dot(const LeftVectorType& vector_left, const RightVectorType& vector_right) {
+    return vector_left.dot(vector_right);
+}
+
 template <typename LeftVectorType, typename RightVectorType>
 decltype(auto) vec_cw_mult(const LeftVectorType& vector_left, const RightVectorType& vector_right) {
     return vector_left.cwiseProduct(vector_right);
@@ -132,6 +148,11 @@ Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, SO>> reshape(const D
 }
 
 /* Matrix Operations */
+template <typename T>
+DynMatrixMap<T> matrix_from_array(T* array, const uint m, const uint n) {
+    return DynMatrixMap<T>(array, m, n);
+}
+
 template <typename MatrixType>
 uint rows(const MatrixType& matrix) {
     return matrix.rows();
@@ -161,6 +182,22 @@ decltype(auto) column(MatrixType&& matrix, const uint col) {
     return matrix.col(col);
 }
 
+template <typename T, typename MatrixType>
+DiagMatrix<T> diagonal_matrix(const MatrixType& matrix) {
+    return DiagMatrix<T>(matrix.diagonal());
+}
+
+// Products hold a DiagMatrix by value, i.e. they copy its diagonal onto the heap, by_reference(matrix) avoids the copy
+template <typename T>
+decltype(auto) by_reference(const DiagMatrix<T>& matrix) {
+    return matrix.diagonal().asDiagonal();
+}
+
+template <typename MatrixType>
+const MatrixType& by_reference(const MatrixType& matrix) {
+    return matrix;
+}
+
 template <typename MatrixType>
 decltype(auto) determinant(MatrixType& matrix) {
     return matrix.determinant();
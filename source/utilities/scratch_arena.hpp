@@ -0,0 +1,102 @@
+#ifndef SCRATCH_ARENA_HPP
+#define SCRATCH_ARENA_HPP
+
+#include "general_definitions.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Utilities {
+// Bump allocator for temporaries of kernels, one per thread. Memory handed out is valid until the innermost
+// enclosing Scope ends, at which point it is reused by the next allocation. Blocks are never returned to the
+// system, hence once the arena has grown to the footprint of the largest kernel no more heap allocations occur.
+// Memory requested outside of any Scope is never reused.
+class ScratchArena {
+  public:
+    class Scope {
+      public:
+        Scope() : arena(ScratchArena::Local()), block(arena.block), top(arena.top) {}
+        ~Scope() {
+            this->arena.block = this->block;
+            this->arena.top   = this->top;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+      private:
+        ScratchArena& arena;
+        uint block;
+        std::size_t top;
+    };
+
+    ScratchArena() = default;
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    static ScratchArena& Local();
+
+    // Number of heap allocations made by the arenas of all threads so far
+    static std::size_t GetNumberAllocations() { return ScratchArena::NumberAllocations().load(); }
+
+    template <typename T>
+    T* Allocate(const std::size_t n);
+
+  private:
+    static std::atomic<std::size_t>& NumberAllocations();
+
+    static constexpr std::size_t alignment      = 64;
+    static constexpr std::size_t min_block_size = 1 << 16;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::vector<std::size_t> block_sizes;
+
+    uint block      = 0;
+    std::size_t top = 0;
+};
+
+inline ScratchArena& ScratchArena::Local() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+inline std::atomic<std::size_t>& ScratchArena::NumberAllocations() {
+    static std::atomic<std::size_t> n_allocations{0};
+    return n_allocations;
+}
+
+template <typename T>
+T* ScratchArena::Allocate(const std::size_t n) {
+    const std::size_t size = (n * sizeof(T) + alignment - 1) / alignment * alignment;
+
+    while (this->block < this->blocks.size() && this->top + size > this->block_sizes[this->block]) {
+        ++this->block;
+        this->top = 0;
+    }
+
+    if (this->block == this->blocks.size()) {
+        std::size_t block_size = std::max(size, (std::size_t)min_block_size);
+        if (!this->block_sizes.empty()) {
+            block_size = std::max(block_size, 2 * this->block_sizes.back());
+        }
+
+        // over-allocate so that the block can start at an aligned address
+        this->blocks.emplace_back(new char[block_size + alignment]);
+        this->block_sizes.push_back(block_size);
+
+        ++ScratchArena::NumberAllocations();
+    }
+
+    char* block_begin = this->blocks[this->block].get();
+    block_begin += (alignment - reinterpret_cast<std::uintptr_t>(block_begin) % alignment) % alignment;
+
+    T* ptr = reinterpret_cast<T*>(block_begin + this->top);
+
+    this->top += size;
+
+    return ptr;
+}
+}
+
+#endif
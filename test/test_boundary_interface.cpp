@@ -14,9 +14,8 @@ int main() {
     using ShapeType   = Shape::StraightTriangle;
     using ElementType = Geometry::Element<2, MasterType, ShapeType, SWE::Data>;
 
-    using RawBoundaryType = Geometry::RawBoundary<1, SWE::Data>;
-    using BoundaryType    = Geometry::Boundary<1, Integration::GaussLegendre_1D, SWE::Data, SWE::RKDG::BC::Land>;
-    using InterfaceType   = Geometry::Interface<1, Integration::GaussLegendre_1D, SWE::Data, SWE::RKDG::ISP::Internal>;
+    using BoundaryType  = Geometry::Boundary<1, Integration::GaussLegendre_1D, SWE::Data, SWE::RKDG::BC::Land>;
+    using InterfaceType = Geometry::Interface<1, Integration::GaussLegendre_1D, SWE::Data, SWE::RKDG::ISP::Internal>;
 
     // make an equilateral triangle
     AlignedVector<Point<3>> vrtxs(3);
@@ -40,7 +39,7 @@ int main() {
         std::vector<uint>{DEFAULT_ID, DEFAULT_ID, DEFAULT_ID},
         std::vector<uchar>{SWE::BoundaryTypes::land, SWE::BoundaryTypes::land, SWE::BoundaryTypes::land});
 
-    std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>> raw_boundary;
+    std::map<uchar, Geometry::RawBoundaryTable<1, SWE::Data>> raw_boundary;
 
     // generate boundaries
     triangle.CreateRawBoundaries(raw_boundary);
@@ -17,9 +17,8 @@ int main() {
     using ShapeType   = Shape::StraightTriangle;
     using ElementType = Geometry::Element<2, MasterType, ShapeType, SWE::Data>;
 
-    using RawBoundaryType = Geometry::RawBoundary<1, SWE::Data>;
-    using BoundaryType    = Geometry::Boundary<1, Integration::GaussLegendre_1D, SWE::Data, SWE::EHDG::BC::Land>;
-    using InterfaceType   = Geometry::Interface<1, Integration::GaussLegendre_1D, SWE::Data, SWE::EHDG::ISP::Internal>;
+    using BoundaryType  = Geometry::Boundary<1, Integration::GaussLegendre_1D, SWE::Data, SWE::EHDG::BC::Land>;
+    using InterfaceType = Geometry::Interface<1, Integration::GaussLegendre_1D, SWE::Data, SWE::EHDG::ISP::Internal>;
 
     using EdgeBoundaryTypes =
         Geometry::EdgeBoundaryTypeTuple<SWE::EdgeData,
@@ -47,7 +46,7 @@ int main() {
         std::vector<uint>{DEFAULT_ID, DEFAULT_ID, DEFAULT_ID},
         std::vector<uchar>{SWE::BoundaryTypes::land, SWE::BoundaryTypes::land, SWE::BoundaryTypes::land});
 
-    std::map<uchar, std::map<std::pair<uint, uint>, RawBoundaryType>> raw_boundary;
+    std::map<uchar, Geometry::RawBoundaryTable<1, SWE::Data>> raw_boundary;
 
     triangle.CreateRawBoundaries(raw_boundary);
 
@@ -0,0 +1,93 @@
+#include "general_definitions.hpp"
+#include "utilities/almost_equal.hpp"
+#include "geometry/mesh_definitions.hpp"
+#include "problem/SWE/discretization_RKDG/rkdg_swe_problem.hpp"
+
+using MasterType  = Master::Quadrilateral<Basis::Legendre_2D, Integration::GaussLegendre_2D>;
+using ShapeType   = Shape::StraightQuadrilateral;
+using ElementType = Geometry::Element<2, MasterType, ShapeType, SWE::Data>;
+
+using Utilities::almost_equal;
+
+int main() {
+    bool error_found = false;
+
+    // make a parallelogram, nodes given in cw order
+    AlignedVector<Point<3>> vrtxs(4);
+    vrtxs[0] = {0.0, 0.0, 0.};
+    vrtxs[1] = {0.5, 1.0, 0.};
+    vrtxs[2] = {2.5, 1.0, 0.};
+    vrtxs[3] = {2.0, 0.0, 0.};
+
+    MasterType master(4);
+
+    ElementType quad(0, master, std::move(vrtxs), std::vector<uint>(0), std::vector<uint>(0), std::vector<uchar>(0));
+
+    if (!almost_equal(quad.GetShape().GetArea(), 2.0)) {
+        error_found = true;
+
+        std::cerr << "Error found in Quadrilateral element in GetArea" << std::endl;
+    }
+
+    const uint nvar = 3;
+
+    DynMatrix<double> u(nvar, master.ndof);
+    for (uint var = 0; var < nvar; ++var) {
+        for (uint dof = 0; dof < master.ndof; ++dof) {
+            u(var, dof) = std::sin(1.0 + var + 0.37 * dof);
+        }
+    }
+
+    // sum factorized evaluation at Gauss points against the dense product
+    DynMatrix<double> u_gp       = quad.ComputeUgp(u);
+    DynMatrix<double> u_gp_dense = u * master.phi_gp;
+
+    for (uint var = 0; var < nvar; ++var) {
+        for (uint gp = 0; gp < master.ngp; ++gp) {
+            if (!almost_equal(u_gp(var, gp), u_gp_dense(var, gp), 1.e+04)) {
+                error_found = true;
+
+                std::cerr << "Error found in Quadrilateral element in ComputeUgp - integrated value: " << u_gp(var, gp)
+                          << " - dense value: " << u_gp_dense(var, gp) << std::endl;
+            }
+        }
+    }
+
+    // sum factorized integration against the dense integration of a single dof
+    for (uint dir = 0; dir < 2; ++dir) {
+        DynMatrix<double> int_dphi = quad.IntegrationDPhi(dir, u_gp);
+
+        for (uint dof = 0; dof < master.ndof; ++dof) {
+            DynVector<double> int_dphi_dense = quad.IntegrationDPhi(dir, dof, u_gp);
+
+            for (uint var = 0; var < nvar; ++var) {
+                if (!almost_equal(int_dphi(var, dof), int_dphi_dense[var], 1.e+04)) {
+                    error_found = true;
+
+                    std::cerr << "Error found in Quadrilateral element in IntegrationDPhi - integrated value: "
+                              << int_dphi(var, dof) << " - dense value: " << int_dphi_dense[var] << std::endl;
+                }
+            }
+        }
+    }
+
+    // L2 projection recovers the modal coefficients
+    DynMatrix<double> u_proj = quad.ApplyMinv(quad.IntegrationPhi(u_gp));
+
+    for (uint var = 0; var < nvar; ++var) {
+        for (uint dof = 0; dof < master.ndof; ++dof) {
+            if (!almost_equal(u_proj(var, dof), u(var, dof), 1.e+04)) {
+                error_found = true;
+
+                std::cerr << "Error found in Quadrilateral element in ApplyMinv - projected value: " << u_proj(var, dof)
+                          << " - true value: " << u(var, dof) << std::endl;
+            }
+        }
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "general_definitions.hpp"
+#include "utilities/almost_equal.hpp"
+#include "utilities/linear_algebra/gmres.hpp"
+
+#include <iostream>
+
+int main() {
+    bool error_found{false};
+
+    const uint n = 40;
+
+    // nonsymmetric, diagonally dominant test matrix
+    DynMatrix<double> A(n, n);
+    DynVector<double> b(n);
+    DynVector<double> D_inv(n);
+
+    for (uint i = 0; i < n; ++i) {
+        for (uint j = 0; j < n; ++j) {
+            A(i, j) = std::sin(1.0 + i + 3.0 * j) / n;
+        }
+
+        A(i, i) += 2.0 + i % 7;
+
+        b[i] = std::cos(2.0 * i);
+
+        D_inv[i] = 1.0 / A(i, i);
+    }
+
+    DynVector<double> x_true = b;
+
+    DynMatrix<double> A_copy = A;
+    solve_sle(A_copy, x_true);
+
+    auto apply_A = [&A](const DynVector<double>& x, DynVector<double>& Ax) { Ax = A * x; };
+
+    auto identity = [](const DynVector<double>& x, DynVector<double>& M_inv_x) { M_inv_x = x; };
+
+    auto jacobi = [&D_inv](const DynVector<double>& x, DynVector<double>& M_inv_x) {
+        M_inv_x = vec_cw_mult(D_inv, x);
+    };
+
+    // unpreconditioned, restarted
+    {
+        DynVector<double> x(n);
+        set_constant(x, 0.0);
+
+        const uint iter = solve_gmres<double>(apply_A, identity, b, x, 1.0e-13, 1000, 10);
+
+        if (!Utilities::almost_equal(0.0, norm(x - x_true) / norm(x_true), 1.0e+04)) {
+            std::cerr << "Error in unpreconditioned GMRES: relative error " << norm(x - x_true) / norm(x_true)
+                      << " after " << iter << " iterations\n";
+            error_found = true;
+        }
+    }
+
+    // Jacobi preconditioned, nonzero initial guess
+    {
+        DynVector<double> x(b);
+
+        const uint iter = solve_gmres<double>(apply_A, jacobi, b, x, 1.0e-13, 1000, 50);
+
+        if (!Utilities::almost_equal(0.0, norm(x - x_true) / norm(x_true), 1.0e+04)) {
+            std::cerr << "Error in preconditioned GMRES: relative error " << norm(x - x_true) / norm(x_true) << " after "
+                      << iter << " iterations\n";
+            error_found = true;
+        }
+    }
+
+    // zero rhs
+    {
+        DynVector<double> zero(n);
+        set_constant(zero, 0.0);
+
+        DynVector<double> x(b);
+
+        const uint iter = solve_gmres<double>(apply_A, identity, zero, x, 1.0e-13, 1000, 50);
+
+        if (iter != 0 || !Utilities::almost_equal(0.0, norm(x))) {
+            std::cerr << "Error in GMRES: zero rhs did not return zero solution\n";
+            error_found = true;
+        }
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <stdexcept>
+
+#ifdef USE_EIGEN
+// Report heap allocations made by Eigen while they are disallowed, also when assertions are compiled out
+#define EIGEN_RUNTIME_NO_MALLOC
+#define eigen_assert(x) check_eigen_assert(x, #x)
+
+inline void check_eigen_assert(const bool condition, const char* expression) {
+    if (!condition) {
+        throw std::logic_error("Fatal Error: Eigen assertion failed: " + std::string(expression));
+    }
+}
+#endif
+
+#include "general_definitions.hpp"
+#include "utilities/almost_equal.hpp"
+#include "geometry/mesh_definitions.hpp"
+#include "problem/SWE/discretization_RKDG/rkdg_swe_problem.hpp"
+
+using MasterType  = Master::Quadrilateral<Basis::Legendre_2D, Integration::GaussLegendre_2D>;
+using ShapeType   = Shape::StraightQuadrilateral;
+using ElementType = Geometry::Element<2, MasterType, ShapeType, SWE::Data>;
+
+using Utilities::almost_equal;
+using Utilities::ScratchArena;
+
+void set_malloc_allowed(const bool allowed) {
+#ifdef USE_EIGEN
+    Eigen::internal::set_is_malloc_allowed(allowed);
+#endif
+}
+
+int main() {
+    bool error_found = false;
+
+    ScratchArena& arena = ScratchArena::Local();
+
+    // memory is aligned and reused once the scope that requested it ends
+    double* first;
+    {
+        ScratchArena::Scope scope;
+
+        first = arena.Allocate<double>(3);
+
+        if (reinterpret_cast<std::uintptr_t>(first) % 64 != 0 ||
+            reinterpret_cast<std::uintptr_t>(arena.Allocate<double>(5)) % 64 != 0) {
+            error_found = true;
+
+            std::cerr << "Error found in ScratchArena - memory not aligned" << std::endl;
+        }
+    }
+
+    const std::size_t n_allocations = ScratchArena::GetNumberAllocations();
+
+    for (uint iter = 0; iter < 10; ++iter) {
+        ScratchArena::Scope scope;
+
+        if (arena.Allocate<double>(3) != first) {
+            error_found = true;
+
+            std::cerr << "Error found in ScratchArena - memory not reused after scope ended" << std::endl;
+        }
+
+        arena.Allocate<double>(1 << 14);
+    }
+
+    if (ScratchArena::GetNumberAllocations() != n_allocations + 1) {
+        error_found = true;
+
+        std::cerr << "Error found in ScratchArena - expected a single additional block, got "
+                  << ScratchArena::GetNumberAllocations() - n_allocations << std::endl;
+    }
+
+    // a stage of element operations performs no heap allocations once the arena is warm
+    AlignedVector<Point<3>> vrtxs(4);
+    vrtxs[0] = {0.0, 0.0, 0.};
+    vrtxs[1] = {0.5, 1.0, 0.};
+    vrtxs[2] = {2.5, 1.0, 0.};
+    vrtxs[3] = {2.0, 0.0, 0.};
+
+    MasterType master(4);
+
+    ElementType quad(0, master, std::move(vrtxs), std::vector<uint>(0), std::vector<uint>(0), std::vector<uchar>(0));
+
+    const uint nvar = SWE::n_variables;
+
+    HybMatrix<double, SWE::n_variables> u(nvar, master.ndof);
+    for (uint var = 0; var < nvar; ++var) {
+        for (uint dof = 0; dof < master.ndof; ++dof) {
+            u(var, dof) = std::sin(1.0 + var + 0.37 * dof);
+        }
+    }
+
+    HybMatrix<double, SWE::n_variables> u_gp(nvar, master.ngp);
+    HybMatrix<double, SWE::n_variables> rhs(nvar, master.ndof);
+    HybMatrix<double, SWE::n_variables> solution(nvar, master.ndof);
+
+    const auto stage = [&]() {
+        ScratchArena::Scope scope;
+
+        noalias(u_gp) = quad.ComputeUgp(u);
+
+        noalias(rhs) = quad.IntegrationDPhi(GlobalCoord::x, u_gp);
+        noalias(rhs) += quad.IntegrationDPhi(GlobalCoord::y, u_gp);
+        noalias(rhs) += quad.IntegrationPhi(u_gp);
+
+        noalias(solution) = quad.ApplyMinv(rhs);
+    };
+
+    stage();
+
+    const HybMatrix<double, SWE::n_variables> solution_warm = solution;
+    const std::size_t n_allocations_warm                    = ScratchArena::GetNumberAllocations();
+
+    try {
+        set_malloc_allowed(false);
+
+        for (uint iter = 0; iter < 10; ++iter) {
+            stage();
+        }
+
+        set_malloc_allowed(true);
+    } catch (const std::exception& e) {
+        set_malloc_allowed(true);
+
+        error_found = true;
+
+        std::cerr << "Error found in element operations - heap allocation in stage: " << e.what() << std::endl;
+    }
+
+    if (ScratchArena::GetNumberAllocations() != n_allocations_warm) {
+        error_found = true;
+
+        std::cerr << "Error found in element operations - scratch arena grew after warm up" << std::endl;
+    }
+
+    for (uint var = 0; var < nvar; ++var) {
+        for (uint dof = 0; dof < master.ndof; ++dof) {
+            if (!almost_equal(solution(var, dof), solution_warm(var, dof))) {
+                error_found = true;
+
+                std::cerr << "Error found in element operations - value: " << solution(var, dof)
+                          << " - value after warm up: " << solution_warm(var, dof) << std::endl;
+            }
+        }
+    }
+
+    if (error_found) {
+        return 1;
+    }
+
+    return 0;
+}